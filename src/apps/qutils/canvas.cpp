@@ -221,7 +221,7 @@ QPen BaseCanvas::brushToPen(const QBrush &brush) const
 	return pen;
 }
 
-Geom::Size Gfx::ICanvas::textBoundary(const Gfx::Font &font,
+Geom::Size Gfx::ICanvas::measureText(const Gfx::Font &font,
     const std::string &text)
 {
 	auto res =
@@ -257,7 +257,8 @@ QFont BaseCanvas::fromGfxFont(const Gfx::Font &newFont, QFont font)
 	font.setPixelSize(static_cast<int>(newFont.size));
 
 	if (!newFont.family.empty())
-		font.setFamily(QString::fromStdString(newFont.family));
+		font.setFamily(QString::fromUtf8(newFont.family.data(),
+		    static_cast<int>(newFont.family.size())));
 
 	font.setWeight(newFont.weight == Gfx::Font::Weight::Bold()
 	                   ? QFont::Bold
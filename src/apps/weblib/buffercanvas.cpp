@@ -0,0 +1,51 @@
+#include "buffercanvas.h"
+
+#include "base/gfx/recordingcanvas.h"
+#include "base/util/profiler.h"
+
+#include "canvas.h"
+
+namespace Vizzu::Main
+{
+
+void BufferCanvas::frameBegin()
+{
+	RecordingCanvas::frameBegin();
+	calls = 0;
+	::canvas_frameBegin(this);
+}
+
+void BufferCanvas::frameEnd()
+{
+	replay();
+	::canvas_frameEnd(this);
+	Util::Profiler::count("canvas calls", static_cast<double>(calls));
+}
+
+void BufferCanvas::flush()
+{
+	replay();
+	clearCommands();
+}
+
+void BufferCanvas::replay()
+{
+	const auto &commands = getCommands();
+	if (commands.empty()) return;
+	calls += commands.size();
+
+	const auto &strings = getStrings();
+	stringTable.clear();
+	stringTable.reserve(strings.size());
+	for (const auto &str : strings) stringTable.push_back(str.c_str());
+
+	::canvas_replay(this,
+	    commands.data(),
+	    commands.size(),
+	    getArguments().data(),
+	    getArguments().size(),
+	    stringTable.data(),
+	    stringTable.size());
+}
+
+}
@@ -0,0 +1,39 @@
+#ifndef OUTPUT_CANVAS_BUFFER_H
+#define OUTPUT_CANVAS_BUFFER_H
+
+#include <cstddef>
+#include <vector>
+
+#include "base/gfx/recordingcanvas.h"
+#include "chart/rendering/painter/painter.h"
+
+namespace Vizzu::Main
+{
+
+class BufferCanvas : public Gfx::RecordingCanvas, public Draw::Painter
+{
+public:
+	BufferCanvas() = default;
+	~BufferCanvas() override = default;
+
+	void frameBegin() override;
+	void frameEnd() override;
+	void flush() override;
+
+	Gfx::ICanvas &getCanvas() override { return *this; }
+
+	void *getPainter() override
+	{
+		return static_cast<Draw::Painter *>(this);
+	}
+
+private:
+	std::vector<const char *> stringTable;
+	std::size_t calls{};
+
+	void replay();
+};
+
+}
+
+#endif
@@ -123,6 +123,28 @@ const char *vizzu_version() { return Interface::version(); }
 
 void vizzu_setLogging(bool enable) { Interface::setLogging(enable); }
 
+void vizzu_setProfiling(bool enable)
+{
+	Interface::setProfiling(enable);
+}
+
+const char *vizzu_profilerStats()
+{
+	return Interface::getProfilerStats();
+}
+
+void vizzu_clearTextCache() { Interface::clearTextCache(); }
+
+void vizzu_setGlyphAdvanceMode(bool enable)
+{
+	Interface::setGlyphAdvanceMode(enable);
+}
+
+const char *vizzu_textCacheStats()
+{
+	return Interface::getTextCacheStats();
+}
+
 APIHandles::Chart vizzu_createChart()
 {
 	return Interface::getInstance().createChart();
@@ -133,6 +155,11 @@ APIHandles::Canvas vizzu_createCanvas()
 	return Interface::getInstance().createCanvas();
 }
 
+APIHandles::Canvas vizzu_createBufferCanvas()
+{
+	return Interface::getInstance().createBufferCanvas();
+}
+
 void vizzu_pointerMove(APIHandles::Chart chart,
     APIHandles::Canvas canvas,
     int pointerId,
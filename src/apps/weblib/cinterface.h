@@ -41,6 +41,7 @@ struct alignas(double) Value
 
 extern APIHandles::Chart vizzu_createChart();
 extern APIHandles::Canvas vizzu_createCanvas();
+extern APIHandles::Canvas vizzu_createBufferCanvas();
 extern void vizzu_pointerDown(APIHandles::Chart chart,
     APIHandles::Canvas canvas,
     int pointerId,
@@ -63,6 +64,11 @@ extern void vizzu_wheel(APIHandles::Chart chart,
     APIHandles::Canvas canvas,
     double delta);
 extern void vizzu_setLogging(bool enable);
+extern void vizzu_setProfiling(bool enable);
+extern const char *vizzu_profilerStats();
+extern void vizzu_clearTextCache();
+extern void vizzu_setGlyphAdvanceMode(bool enable);
+extern const char *vizzu_textCacheStats();
 extern void vizzu_update(APIHandles::Chart chart, double timeInMSecs);
 extern void vizzu_render(APIHandles::Chart chart,
     APIHandles::Canvas canvas,
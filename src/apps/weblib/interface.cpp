@@ -12,8 +12,10 @@
 
 #include "base/anim/duration.h"
 #include "base/conv/auto_json.h"
+#include "base/gfx/canvas.h"
 #include "base/io/log.h"
 #include "base/refl/auto_accessor.h"
+#include "base/util/profiler.h"
 #include "chart/animator/animation.h"
 #include "chart/generator/plotptr.h"
 #include "chart/main/style.h"
@@ -24,6 +26,7 @@
 #include "chart/ui/chart.h"
 #include "dataframe/old/types.h"
 
+#include "buffercanvas.h"
 #include "cinterface.h"
 #include "interfacejs.h"
 #include "jscriptcanvas.h"
@@ -223,9 +226,11 @@ void Interface::addEventListener(ObjectRegistryHandle chart,
 	auto &&chartPtr = getChart(chart);
 	if (auto &&ev = chartPtr->getEventDispatcher().getEvent(event)) {
 		ev->attach(
-		    [callback](Util::EventDispatcher::Params &params,
+		    [this, callback](Util::EventDispatcher::Params &params,
 		        const std::string &jsonStrIn)
 		    {
+			    // the handler may draw on the rendering context too
+			    if (renderingCanvas) renderingCanvas->flush();
 			    callback(&params, jsonStrIn.c_str());
 		    },
 		    std::hash<decltype(callback)>{}(callback));
@@ -384,11 +389,45 @@ ObjectRegistryHandle Interface::createCanvas()
 	    std::make_shared<Vizzu::Main::JScriptCanvas>());
 }
 
+ObjectRegistryHandle Interface::createBufferCanvas()
+{
+	return objects.reg(std::make_shared<Vizzu::Main::BufferCanvas>());
+}
+
 void Interface::setLogging(bool enable)
 {
 	IO::Log::setEnabled(enable);
 }
 
+void Interface::setProfiling(bool enable)
+{
+	Util::Profiler::setEnabled(enable);
+}
+
+const char *Interface::getProfilerStats()
+{
+	thread_local std::string res;
+	res = Util::Profiler::toJSON();
+	return res.c_str();
+}
+
+void Interface::clearTextCache()
+{
+	Gfx::ICanvas::textBoundaryCache().clear();
+}
+
+void Interface::setGlyphAdvanceMode(bool enable)
+{
+	Gfx::ICanvas::textBoundaryCache().setGlyphAdvanceMode(enable);
+}
+
+const char *Interface::getTextCacheStats()
+{
+	thread_local std::string res;
+	res = Conv::toJSON(Gfx::ICanvas::textBoundaryCache().getStats());
+	return res.c_str();
+}
+
 void Interface::update(ObjectRegistryHandle chart, double timeInMSecs)
 {
 	auto &&widget = objects.get<UI::ChartWidget>(chart);
@@ -409,12 +448,21 @@ void Interface::render(ObjectRegistryHandle chart,
 	auto &&widget = objects.get<UI::ChartWidget>(chart);
 	auto &&ptr = objects.get<Gfx::ICanvas>(canvas);
 
-	ptr->frameBegin();
+	const Util::Profiler::Scope profile{"Interface::render"};
+
+	{
+		const Util::Profiler::Scope profileBegin{
+		    "ICanvas::frameBegin"};
+		ptr->frameBegin();
+	}
 
 	widget->onUpdateSize({width, height});
 
+	renderingCanvas = ptr;
 	widget->onDraw(ptr);
+	renderingCanvas.reset();
 
+	const Util::Profiler::Scope profileEnd{"ICanvas::frameEnd"};
 	ptr->frameEnd();
 }
 
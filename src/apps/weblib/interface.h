@@ -28,7 +28,13 @@ public:
 	static const char *version();
 	ObjectRegistryHandle createChart();
 	ObjectRegistryHandle createCanvas();
+	ObjectRegistryHandle createBufferCanvas();
 	static void setLogging(bool enable);
+	static void setProfiling(bool enable);
+	static const char *getProfilerStats();
+	static void clearTextCache();
+	static void setGlyphAdvanceMode(bool enable);
+	static const char *getTextCacheStats();
 	void pointerMove(ObjectRegistryHandle chart,
 	    ObjectRegistryHandle canvas,
 	    int pointerId,
@@ -141,6 +147,7 @@ private:
 
 	ObjectRegistry<Snapshot, Animation, Gfx::ICanvas, UI::ChartWidget>
 	    objects;
+	std::shared_ptr<Gfx::ICanvas> renderingCanvas;
 };
 
 }
@@ -13,6 +13,7 @@
 #include "base/gfx/color.h"
 #include "base/gfx/colorgradient.h"
 #include "base/gfx/font.h"
+#include "base/util/profiler.h"
 
 #include "canvas.h"
 #include "interfacejs.h"
@@ -24,6 +25,7 @@ void JScriptCanvas::setClipRect(const Geom::Rect &rect)
 {
 	if (!clipRect || *clipRect != rect) {
 		clipRect = rect;
+		++calls;
 		::canvas_setClipRect(this,
 		    rect.pos.x,
 		    rect.pos.y,
@@ -35,6 +37,7 @@ void JScriptCanvas::setClipRect(const Geom::Rect &rect)
 void JScriptCanvas::setClipCircle(const Geom::Circle &circle)
 {
 	clipRect = circle.boundary();
+	++calls;
 	::canvas_setClipCircle(this,
 	    circle.center.x,
 	    circle.center.y,
@@ -43,6 +46,7 @@ void JScriptCanvas::setClipCircle(const Geom::Circle &circle)
 
 void JScriptCanvas::setClipPolygon()
 {
+	++calls;
 	::canvas_setClipPolygon(this);
 }
 
@@ -50,6 +54,7 @@ void JScriptCanvas::setBrushColor(const Gfx::Color &color)
 {
 	if (color != brushColor) {
 		brushColor = color;
+		++calls;
 		::canvas_setBrushColor(this,
 		    color.red,
 		    color.green,
@@ -60,18 +65,21 @@ void JScriptCanvas::setBrushColor(const Gfx::Color &color)
 
 void JScriptCanvas::setLineColor(const Gfx::Color &color)
 {
-	if (color != lineColor)
+	if (color != lineColor) {
+		++calls;
 		::canvas_setLineColor(this,
 		    color.red,
 		    color.green,
 		    color.blue,
 		    color.alpha);
+	}
 }
 
 void JScriptCanvas::setLineWidth(double width)
 {
 	if (width != lineWidth) {
 		lineWidth = width;
+		++calls;
 		::canvas_setLineWidth(this, width);
 	}
 }
@@ -81,22 +89,26 @@ void JScriptCanvas::setFont(const Gfx::Font &font)
 	if (this->font != font) {
 		this->font = font;
 		auto cssFont = font.toCSS();
+		++calls;
 		::canvas_setFont(this, cssFont.c_str());
 	}
 }
 
 void JScriptCanvas::beginDropShadow()
 {
+	++calls;
 	::canvas_beginDropShadow(this);
 }
 
 void JScriptCanvas::setDropShadowBlur(double radius)
 {
+	++calls;
 	::canvas_setDropShadowBlur(this, radius);
 }
 
 void JScriptCanvas::setDropShadowColor(const Gfx::Color &color)
 {
+	++calls;
 	::canvas_setDropShadowColor(this,
 	    color.red,
 	    color.green,
@@ -106,15 +118,25 @@ void JScriptCanvas::setDropShadowColor(const Gfx::Color &color)
 
 void JScriptCanvas::setDropShadowOffset(const Geom::Point &offset)
 {
+	++calls;
 	::canvas_setDropShadowOffset(this, offset.x, offset.y);
 }
 
-void JScriptCanvas::endDropShadow() { ::canvas_endDropShadow(this); }
+void JScriptCanvas::endDropShadow()
+{
+	++calls;
+	::canvas_endDropShadow(this);
+}
 
-void JScriptCanvas::beginPolygon() { ::canvas_beginPolygon(this); }
+void JScriptCanvas::beginPolygon()
+{
+	++calls;
+	::canvas_beginPolygon(this);
+}
 
 void JScriptCanvas::addPoint(const Geom::Point &point)
 {
+	++calls;
 	::canvas_addPoint(this, point.x, point.y);
 }
 
@@ -122,6 +144,7 @@ void JScriptCanvas::addBezier(const Geom::Point &control0,
     const Geom::Point &control1,
     const Geom::Point &endPoint)
 {
+	++calls;
 	canvas_addBezier(this,
 	    control0.x,
 	    control0.y,
@@ -131,10 +154,15 @@ void JScriptCanvas::addBezier(const Geom::Point &control0,
 	    endPoint.y);
 }
 
-void JScriptCanvas::endPolygon() { ::canvas_endPolygon(this); }
+void JScriptCanvas::endPolygon()
+{
+	++calls;
+	::canvas_endPolygon(this);
+}
 
 void JScriptCanvas::rectangle(const Geom::Rect &rect)
 {
+	++calls;
 	::canvas_rectangle(this,
 	    rect.pos.x,
 	    rect.pos.y,
@@ -144,6 +172,7 @@ void JScriptCanvas::rectangle(const Geom::Rect &rect)
 
 void JScriptCanvas::circle(const Geom::Circle &circle)
 {
+	++calls;
 	::canvas_circle(this,
 	    circle.center.x,
 	    circle.center.y,
@@ -152,6 +181,7 @@ void JScriptCanvas::circle(const Geom::Circle &circle)
 
 void JScriptCanvas::line(const Geom::Line &line)
 {
+	++calls;
 	::canvas_line(this,
 	    line.begin.x,
 	    line.begin.y,
@@ -162,6 +192,7 @@ void JScriptCanvas::line(const Geom::Line &line)
 void JScriptCanvas::text(const Geom::Rect &rect,
     const std::string &text)
 {
+	++calls;
 	::canvas_text(this,
 	    rect.pos.x,
 	    rect.pos.y,
@@ -188,6 +219,7 @@ void JScriptCanvas::setBrushGradient(
 	static_assert(
 	    std::is_same_v<decltype(Stop::value.alpha), double>);
 
+	++calls;
 	::canvas_setBrushGradient(this,
 	    gradient.line.begin.x,
 	    gradient.line.begin.y,
@@ -197,17 +229,23 @@ void JScriptCanvas::setBrushGradient(
 	    gradient.colors.stops.data());
 }
 
-void JScriptCanvas::frameEnd() { ::canvas_frameEnd(this); }
+void JScriptCanvas::frameEnd()
+{
+	::canvas_frameEnd(this);
+	Util::Profiler::count("canvas calls", static_cast<double>(calls));
+}
 
 void JScriptCanvas::frameBegin()
 {
 	resetStates();
+	calls = 0;
 	::canvas_frameBegin(this);
 }
 
 void JScriptCanvas::transform(const Geom::AffineTransform &transform)
 {
 	const auto &[r0, r1] = transform.getMatrix();
+	++calls;
 	::canvas_transform(this,
 	    r0[0],
 	    r1[0],
@@ -217,10 +255,15 @@ void JScriptCanvas::transform(const Geom::AffineTransform &transform)
 	    r1[2]);
 }
 
-void JScriptCanvas::save() { ::canvas_save(this); }
+void JScriptCanvas::save()
+{
+	++calls;
+	::canvas_save(this);
+}
 
 void JScriptCanvas::restore()
 {
+	++calls;
 	::canvas_restore(this);
 	resetStates();
 }
@@ -236,7 +279,7 @@ void JScriptCanvas::resetStates()
 
 }
 
-Geom::Size Gfx::ICanvas::textBoundary(const Gfx::Font &font,
+Geom::Size Gfx::ICanvas::measureText(const Gfx::Font &font,
     const std::string &text)
 {
 	Geom::Size res;
@@ -1,6 +1,7 @@
 #ifndef OUTPUT_CANVAS_JSCRIPT_H
 #define OUTPUT_CANVAS_JSCRIPT_H
 
+#include <cstddef>
 #include <functional>
 #include <optional>
 
@@ -68,6 +69,7 @@ private:
 	std::optional<Gfx::Color> lineColor;
 	std::optional<double> lineWidth;
 	std::optional<Geom::Rect> clipRect;
+	std::size_t calls{};
 };
 
 }
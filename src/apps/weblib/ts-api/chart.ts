@@ -52,7 +52,7 @@ export class Chart implements ChartInterface {
 		this._cChart = this._module.createChart()
 		this._module.registerChart(this._cChart, this)
 
-		this._cCanvas = this._module.createCanvas()
+		this._cCanvas = this._module.createBufferCanvas()
 		this._cData = this._module.getData(this._cChart)
 		this._data = new Data(this._cData)
 
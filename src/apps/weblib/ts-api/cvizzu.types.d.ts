@@ -67,6 +67,7 @@ export interface CVizzu {
 	// exported functions
 	_vizzu_createChart(): CChartPtr
 	_vizzu_createCanvas(): CCanvasPtr
+	_vizzu_createBufferCanvas(): CCanvasPtr
 	_vizzu_pointerDown(
 		chart: CChartPtr,
 		canvas: CCanvasPtr,
@@ -91,6 +92,11 @@ export interface CVizzu {
 	_vizzu_pointerLeave(chart: CChartPtr, canvas: CCanvasPtr, pointerId: number): void
 	_vizzu_wheel(chart: CChartPtr, canvas: CCanvasPtr, delta: number): void
 	_vizzu_setLogging(enable: boolean): void
+	_vizzu_setProfiling(enable: boolean): void
+	_vizzu_profilerStats(): CString
+	_vizzu_clearTextCache(): void
+	_vizzu_setGlyphAdvanceMode(enable: boolean): void
+	_vizzu_textCacheStats(): CString
 	_vizzu_update(chart: CChartPtr, time: number): void
 	_vizzu_setLineResolution(canvas: CCanvasPtr, distanceMax: number, curveHeightMax: number): void
 	_vizzu_render(chart: CChartPtr, canvas: CCanvasPtr, width: number, height: number): void
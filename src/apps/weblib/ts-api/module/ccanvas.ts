@@ -1,7 +1,43 @@
 import { type CEnv, CManagedObject } from './cenv.js'
 import { type CPointerClosure } from './objregistry.js'
 import { CColorGradient } from './ccolorgradient.js'
-import type { CString, CColorGradientPtr } from '../cvizzu.types'
+import type { CString, CColorGradientPtr, CArrayPtr } from '../cvizzu.types'
+
+/** Opcodes of the binary draw command stream, see Gfx::RecordingCanvas. */
+export enum DrawCommand {
+	setClipRect,
+	setClipCircle,
+	setClipPolygon,
+	setBrushColor,
+	setLineColor,
+	setLineWidth,
+	setFont,
+	beginDropShadow,
+	setDropShadowBlur,
+	setDropShadowColor,
+	setDropShadowOffset,
+	endDropShadow,
+	beginPolygon,
+	addPoint,
+	addBezier,
+	endPolygon,
+	rectangle,
+	circle,
+	line,
+	text,
+	setBrushGradient,
+	transform,
+	save,
+	restore,
+	rectangles,
+	circles
+}
+
+export interface DrawCommands {
+	commands: Uint8Array
+	args: Float64Array
+	strings: string[]
+}
 
 export class CCanvas extends CManagedObject {
 	constructor(env: CEnv, getId: CPointerClosure) {
@@ -15,4 +51,21 @@ export class CCanvas extends CManagedObject {
 	getString(text: CString): string {
 		return this._wasm.UTF8ToString(text)
 	}
+
+	getDrawCommands(
+		commands: CArrayPtr,
+		commandCount: number,
+		args: CArrayPtr,
+		argCount: number,
+		strings: CArrayPtr,
+		stringCount: number
+	): DrawCommands {
+		const buffer = this._wasm.HEAPU8.buffer
+		const stringPtrs = new Uint32Array(buffer, strings, stringCount)
+		return {
+			commands: new Uint8Array(buffer, commands, commandCount),
+			args: new Float64Array(buffer, args, argCount),
+			strings: Array.from(stringPtrs, (ptr) => this._wasm.UTF8ToString(ptr))
+		}
+	}
 }
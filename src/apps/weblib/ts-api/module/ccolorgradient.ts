@@ -1,12 +1,16 @@
 import { CColorGradientPtr } from '../cvizzu.types.js'
 import { CEnv, CObject } from './cenv.js'
 
-interface ColorStop {
+export interface ColorStop {
 	offset: number
 	color: string
 }
 
-export class CColorGradient extends CObject {
+export interface ColorGradient {
+	stops: ColorStop[]
+}
+
+export class CColorGradient extends CObject implements ColorGradient {
 	stops: ColorStop[]
 
 	constructor(env: CEnv, stopsPtr: CColorGradientPtr, stopCount: number) {
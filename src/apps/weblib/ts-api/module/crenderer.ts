@@ -1,5 +1,5 @@
 import type { CCanvas } from './ccanvas.js'
-import type { CColorGradient } from './ccolorgradient.js'
+import type { ColorGradient } from './ccolorgradient.js'
 import type { CString, CColorGradientPtr } from '../cvizzu.types'
 
 export abstract class CRenderer {
@@ -12,7 +12,7 @@ export abstract class CRenderer {
 		y1: number,
 		x2: number,
 		y2: number,
-		gradient: CColorGradient
+		gradient: ColorGradient
 	): void
 
 	setFont(font: CString): void {
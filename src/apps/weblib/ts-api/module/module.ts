@@ -19,6 +19,7 @@ export class Module extends CEnv {
 		this._wasm.canvases = {}
 		this._wasm.charts = {}
 		this.setLogging(false)
+		document.fonts.addEventListener('loadingdone', () => this.clearTextCache())
 	}
 
 	registerChart(cChart: CChart, chart: Chart): void {
@@ -45,6 +46,26 @@ export class Module extends CEnv {
 		this._callStatic(this._wasm._vizzu_setLogging)(enabled)
 	}
 
+	setProfiling(enabled: boolean): void {
+		this._callStatic(this._wasm._vizzu_setProfiling)(enabled)
+	}
+
+	profilerStats(): string {
+		return this._fromCString(this._callStatic(this._wasm._vizzu_profilerStats)())
+	}
+
+	clearTextCache(): void {
+		this._callStatic(this._wasm._vizzu_clearTextCache)()
+	}
+
+	setGlyphAdvanceMode(enabled: boolean): void {
+		this._callStatic(this._wasm._vizzu_setGlyphAdvanceMode)(enabled)
+	}
+
+	textCacheStats(): string {
+		return this._fromCString(this._callStatic(this._wasm._vizzu_textCacheStats)())
+	}
+
 	getData(cChart: CChart): CData {
 		return new CData(cChart.getId, this)
 	}
@@ -64,4 +85,8 @@ export class Module extends CEnv {
 	createCanvas(): CCanvas {
 		return new CCanvas(this, this._getStatic(this._wasm._vizzu_createCanvas))
 	}
+
+	createBufferCanvas(): CCanvas {
+		return new CCanvas(this, this._getStatic(this._wasm._vizzu_createBufferCanvas))
+	}
 }
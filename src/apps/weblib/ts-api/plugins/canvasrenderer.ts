@@ -1,4 +1,6 @@
-import { CColorGradient } from '../module/ccolorgradient.js'
+import { ColorGradient } from '../module/ccolorgradient.js'
+import { DrawCommand } from '../module/ccanvas.js'
+import type { CArrayPtr } from '../cvizzu.types'
 import { Canvas } from '../module/canvas.js'
 import { CRenderer } from '../module/crenderer.js'
 import { Plugin, PluginHooks, RenderContext as Ctx } from '../plugins.js'
@@ -182,7 +184,7 @@ export class CanvasRenderer extends CRenderer implements Canvas, Plugin {
 		dc.fillText(text, x, y)
 	}
 
-	setGradient(x1: number, y1: number, x2: number, y2: number, gradient: CColorGradient): void {
+	setGradient(x1: number, y1: number, x2: number, y2: number, gradient: ColorGradient): void {
 		const dc = this._context
 		const grd = dc.createLinearGradient(x1, y1, x2, y2)
 		gradient.stops.forEach((g) => grd.addColorStop(g.offset, g.color))
@@ -203,4 +205,136 @@ export class CanvasRenderer extends CRenderer implements Canvas, Plugin {
 		const dc = this._context
 		dc.restore()
 	}
+
+	replay(
+		commands: CArrayPtr,
+		commandCount: number,
+		args: CArrayPtr,
+		argCount: number,
+		strings: CArrayPtr,
+		stringCount: number
+	): void {
+		if (!this.canvas) return
+		const buffer = this.canvas.getDrawCommands(
+			commands,
+			commandCount,
+			args,
+			argCount,
+			strings,
+			stringCount
+		)
+		const ops = buffer.commands
+		const a = buffer.args
+		const str = buffer.strings
+		let i = 0
+		for (const op of ops) {
+			switch (op) {
+				case DrawCommand.setClipRect:
+					this.setClipRect(a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+					break
+				case DrawCommand.setClipCircle:
+					this.setClipCircle(a[i++]!, a[i++]!, a[i++]!)
+					break
+				case DrawCommand.setClipPolygon:
+					this.setClipPolygon()
+					break
+				case DrawCommand.setBrushColor:
+					this.setBrushColor(a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+					break
+				case DrawCommand.setLineColor:
+					this.setLineColor(a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+					break
+				case DrawCommand.setLineWidth:
+					this.setLineWidth(a[i++]!)
+					break
+				case DrawCommand.setFont:
+					this.setFontStyle(str[a[i++]!]!)
+					break
+				case DrawCommand.beginDropShadow:
+					this.beginDropShadow()
+					break
+				case DrawCommand.setDropShadowBlur:
+					this.setDropShadowBlur(a[i++]!)
+					break
+				case DrawCommand.setDropShadowColor:
+					this.setDropShadowColor(a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+					break
+				case DrawCommand.setDropShadowOffset:
+					this.setDropShadowOffset(a[i++]!, a[i++]!)
+					break
+				case DrawCommand.endDropShadow:
+					this.endDropShadow()
+					break
+				case DrawCommand.beginPolygon:
+					this.beginPolygon()
+					break
+				case DrawCommand.addPoint:
+					this.addPoint(a[i++]!, a[i++]!)
+					break
+				case DrawCommand.addBezier:
+					this.addBezier(a[i++]!, a[i++]!, a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+					break
+				case DrawCommand.endPolygon:
+					this.endPolygon()
+					break
+				case DrawCommand.rectangle:
+					this.rectangle(a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+					break
+				case DrawCommand.circle:
+					this.circle(a[i++]!, a[i++]!, a[i++]!)
+					break
+				case DrawCommand.line:
+					this.line(a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+					break
+				case DrawCommand.text:
+					this.drawText(a[i++]!, a[i++]!, a[i++]!, a[i++]!, str[a[i++]!]!)
+					break
+				case DrawCommand.setBrushGradient: {
+					const x1 = a[i++]!
+					const y1 = a[i++]!
+					const x2 = a[i++]!
+					const y2 = a[i++]!
+					const stops = []
+					for (let count = a[i++]!; count > 0; --count) {
+						stops.push({
+							offset: a[i++]!,
+							color: `rgba(${a[i++]! * 255},${a[i++]! * 255},${a[i++]! * 255},${a[i++]!})`
+						})
+					}
+					this.setGradient(x1, y1, x2, y2, { stops })
+					break
+				}
+				case DrawCommand.transform:
+					this.transform(a[i++]!, a[i++]!, a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+					break
+				case DrawCommand.save:
+					this.save()
+					break
+				case DrawCommand.restore:
+					this.restore()
+					break
+				case DrawCommand.rectangles:
+					for (let count = a[i++]!; count > 0; --count) {
+						const x = a[i++]!
+						const y = a[i++]!
+						const width = a[i++]!
+						const height = a[i++]!
+						this.setBrushColor(a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+						this.setLineColor(a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+						this.rectangle(x, y, width, height)
+					}
+					break
+				case DrawCommand.circles:
+					for (let count = a[i++]!; count > 0; --count) {
+						const x = a[i++]!
+						const y = a[i++]!
+						const radius = a[i++]!
+						this.setBrushColor(a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+						this.setLineColor(a[i++]!, a[i++]!, a[i++]!, a[i++]!)
+						this.circle(x, y, radius)
+					}
+					break
+			}
+		}
+	}
 }
@@ -3,6 +3,8 @@
 #include <memory>
 #include <utility>
 
+#include "base/util/profiler.h"
+
 #include "duration.h"
 #include "element.h"
 
@@ -62,6 +64,7 @@ const Options &Group::addElement(std::unique_ptr<IElement> element,
 
 void Group::setPosition(Duration progress)
 {
+	const Util::Profiler::Scope profile{"Group::setPosition"};
 	for (const auto &element : elements) {
 		auto factor = element.options.getFactor(progress);
 		element.element->transform(factor);
@@ -2,13 +2,14 @@
 #include "numtostr.h"
 
 #include <algorithm>
+#include <charconv>
 #include <cmath>
 #include <cstdint>
-#include <cstdio>
 #include <limits>
 #include <stdexcept>
 #include <string>
 #include <string_view>
+#include <system_error>
 
 namespace Conv
 {
@@ -30,11 +31,16 @@ std::string NumberToString::convert(double number)
 		    && other_remainder - roundPoint >= roundPoint - remainder)
 			number = next;
 
-	std::string_view number_view(begin,
-	    std::snprintf(begin,
-	        MAX_BUFFER_SIZE,
-	        ("%." + std::to_string(fractionDigitCount) + "f").c_str(),
-	        number));
+	auto [end, error] = std::to_chars(begin,
+	    begin + MAX_BUFFER_SIZE,
+	    number,
+	    std::chars_format::fixed,
+	    std::max(fractionDigitCount, 0));
+	if (error != std::errc{})
+		throw std::runtime_error(
+		    "NumToStr serialize failed - buffer is small");
+
+	std::string_view number_view(begin, end);
 
 	auto decimalPoint = std::min({number_view.find(','),
 	    number_view.find('.'),
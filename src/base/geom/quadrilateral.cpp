@@ -1,6 +1,8 @@
 #include "quadrilateral.h"
 
 #include <algorithm>
+#include <limits>
+#include <utility>
 
 #include "base/math/floating.h"
 
@@ -32,4 +34,35 @@ double ConvexQuad::distance(const Point &point) const
 	    Math::Floating::less);
 }
 
-}
\ No newline at end of file
+bool ConvexQuad::overlaps(const ConvexQuad &other) const
+{
+	auto project = [](const Points &points, const Point &axis)
+	{
+		std::pair res{std::numeric_limits<double>::max(),
+		    std::numeric_limits<double>::lowest()};
+		for (const auto &point : points) {
+			auto pos = point.x * axis.x + point.y * axis.y;
+			res.first = std::min(res.first, pos);
+			res.second = std::max(res.second, pos);
+		}
+		return res;
+	};
+
+	for (const auto *quad : {&points, &other.points})
+		for (auto i = 0U; i < quad->size(); ++i) {
+			auto axis =
+			    ((*quad)[(i + 1) % quad->size()] - (*quad)[i]).normal(
+			        false);
+			auto [min0, max0] = project(points, axis);
+			auto [min1, max1] = project(other.points, axis);
+			if (max0 <= min1 || max1 <= min0) return false;
+		}
+	return true;
+}
+
+Rect ConvexQuad::boundary() const
+{
+	return Rect::Boundary(points);
+}
+
+}
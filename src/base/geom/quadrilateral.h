@@ -23,6 +23,8 @@ public:
 	    double base1Length);
 
 	[[nodiscard]] double distance(const Point &point) const;
+	[[nodiscard]] bool overlaps(const ConvexQuad &other) const;
+	[[nodiscard]] Rect boundary() const;
 };
 
 }
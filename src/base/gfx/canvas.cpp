@@ -0,0 +1,20 @@
+#include "canvas.h"
+
+#include <string>
+
+namespace Gfx
+{
+
+Geom::Size ICanvas::textBoundary(const Font &font,
+    const std::string &text)
+{
+	return textBoundaryCache().get(font, text);
+}
+
+TextBoundaryCache &ICanvas::textBoundaryCache()
+{
+	static TextBoundaryCache cache{&ICanvas::measureText};
+	return cache;
+}
+
+}
@@ -1,6 +1,9 @@
 #ifndef GFX_CANVAS
 #define GFX_CANVAS
 
+#include <cstddef>
+#include <functional>
+#include <span>
 #include <string>
 
 #include "base/geom/affinetransform.h"
@@ -11,11 +14,22 @@
 #include "base/gfx/color.h"
 #include "base/gfx/font.h"
 #include "base/gfx/lineargradient.h"
+#include "base/gfx/textboundarycache.h"
 
 namespace Gfx
 {
 struct ICanvas
 {
+	// screen space tiles in the actual coordinate system, tile
+	// (column, row) has the index row * columns + column
+	struct TileGrid
+	{
+		Geom::Point origin;
+		Geom::Size tileSize;
+		std::size_t columns{};
+		std::size_t rows{};
+	};
+
 	virtual ~ICanvas() = default;
 
 	virtual void setClipRect(const Geom::Rect &rect) = 0;
@@ -47,6 +61,34 @@ struct ICanvas
 	virtual void circle(const Geom::Circle &circle) = 0;
 	virtual void line(const Geom::Line &line) = 0;
 
+	// batched rectangle() and circle() calls, the i-th shape is drawn
+	// with the i-th brush and line color; false if not supported
+	virtual bool rectangles(std::span<const Geom::Rect>,
+	    std::span<const Gfx::Color>,
+	    std::span<const Gfx::Color>)
+	{
+		return false;
+	}
+	virtual bool circles(std::span<const Geom::Circle>,
+	    std::span<const Gfx::Color>,
+	    std::span<const Gfx::Color>)
+	{
+		return false;
+	}
+
+	// tiles which can be drawn independently through drawTiles(),
+	// empty if not supported
+	[[nodiscard]] virtual TileGrid tileGrid() const { return {}; }
+
+	// calls drawTile concurrently for each tile with a sub-canvas
+	// clipped to it, the sub-canvases provide no painter;
+	// false if not supported
+	virtual bool drawTiles(
+	    const std::function<void(std::size_t, ICanvas &)> &)
+	{
+		return false;
+	}
+
 	virtual void text(const Geom::Rect &rect,
 	    const std::string &text) = 0;
 
@@ -55,10 +97,24 @@ struct ICanvas
 	virtual void frameBegin() = 0;
 	virtual void frameEnd() = 0;
 
+	// draws the buffered commands before the caller draws directly
+	// to the underlying surface, e.g. from a draw event handler
+	virtual void flush() {}
+
+	virtual bool replayLayer(std::size_t, std::size_t)
+	{
+		return false;
+	}
+	virtual void beginLayer(std::size_t, std::size_t) {}
+	virtual void endLayer() {}
+
 	virtual void *getPainter() = 0;
 
 	static Geom::Size textBoundary(const Gfx::Font &,
 	    const std::string &);
+	static Geom::Size measureText(const Gfx::Font &,
+	    const std::string &);
+	static TextBoundaryCache &textBoundaryCache();
 };
 
 }
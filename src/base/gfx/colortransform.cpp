@@ -1,12 +1,13 @@
-
 #include "colortransform.h"
 
+#include <cstddef>
 #include <stdexcept>
 #include <string>
 #include <utility>
 
 #include "base/text/funcstring.h"
 #include "base/text/smartstring.h"
+#include "base/util/hash.h"
 
 #include "color.h"
 
@@ -39,83 +40,104 @@ ColorTransform ColorTransform::fromString(const std::string &code)
 
 ColorTransform ColorTransform::OverrideColor(Color overrideColor)
 {
-	return {[=](const Color &)
-	    {
-		    return overrideColor;
-	    },
-	    "color(" + std::string{overrideColor} + ")"};
+	return {Type::color, overrideColor, 0.0};
 }
 
 ColorTransform ColorTransform::Grayscale(double factor)
 {
-	return {[=](const Color &color)
-	    {
-		    return color.desaturate(factor);
-	    },
-	    "grayscale(" + std::to_string(factor) + ")"};
+	return {Type::grayscale, {}, factor};
 }
 
 ColorTransform ColorTransform::Lightness(double factor)
 {
-	return {[=](const Color &color)
-	    {
-		    return color.lightnessScaled(factor);
-	    },
-	    "lightness(" + std::to_string(factor) + ")"};
+	return {Type::lightness, {}, factor};
 }
 
 ColorTransform ColorTransform::Opacity(double factor)
 {
-	return {[=](const Color &color)
-	    {
-		    return color * factor;
-	    },
-	    "opacity(" + std::to_string(factor) + ")"};
+	return {Type::opacity, {}, factor};
 }
 
 ColorTransform ColorTransform::None()
 {
-	return {[=](const Color &color)
-	    {
-		    return color;
-	    },
-	    "none"};
+	return {Type::none, {}, 0.0};
 }
 
-ColorTransform::ColorTransform(Convert convert, std::string code) :
-    code(std::move(code)),
+ColorTransform::ColorTransform(Type type,
+    Color color,
+    double factor) :
+    type(type),
+    color(color),
+    factor(factor)
+{}
+
+ColorTransform::ColorTransform(Convert convert) :
     convert(std::move(convert))
 {}
 
 bool ColorTransform::operator==(const ColorTransform &other) const
 {
-	return code == other.code;
+	return type == other.type && color == other.color
+	    && factor == other.factor;
 }
 
 ColorTransform ColorTransform::operator*(double value) const
 {
-	return {[*this, value](const Color &color)
+	return ColorTransform{[*this, value](const Color &color)
 	    {
 		    return (*this)(color)*value;
-	    },
-	    ""};
+	    }};
 }
 
 ColorTransform ColorTransform::operator+(
     const ColorTransform &other) const
 {
-	return {[*this, other](const Color &color)
+	return ColorTransform{[*this, other](const Color &color)
 	    {
 		    return (*this)(color) + other(color);
-	    },
-	    ""};
+	    }};
 }
 
 Color ColorTransform::operator()(const Color &color) const
 {
-	return convert ? convert(color) : color;
+	switch (type) {
+	case Type::none: return color;
+	case Type::color: return this->color;
+	case Type::grayscale: return color.desaturate(factor);
+	case Type::lightness: return color.lightnessScaled(factor);
+	case Type::opacity: return color * factor;
+	default:
+	case Type::combined: return convert ? convert(color) : color;
+	}
 }
 
-ColorTransform::operator std::string() const { return code; }
+ColorTransform::operator std::string() const
+{
+	switch (type) {
+	case Type::none: return "none";
+	case Type::color: return "color(" + std::string{color} + ")";
+	case Type::grayscale:
+		return "grayscale(" + std::to_string(factor) + ")";
+	case Type::lightness:
+		return "lightness(" + std::to_string(factor) + ")";
+	case Type::opacity:
+		return "opacity(" + std::to_string(factor) + ")";
+	default:
+	case Type::combined: return {};
+	}
+}
 
-}
\ No newline at end of file
+}
+
+std::size_t std::hash<Gfx::ColorTransform>::operator()(
+    const Gfx::ColorTransform &transform) const noexcept
+{
+	return Util::Hash{}
+	    .add(transform.type,
+	        transform.color.red,
+	        transform.color.green,
+	        transform.color.blue,
+	        transform.color.alpha,
+	        transform.factor)
+	    .get();
+}
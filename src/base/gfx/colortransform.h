@@ -1,7 +1,10 @@
 #ifndef GFX_COLORTRANSFORM
 #define GFX_COLORTRANSFORM
 
+#include <cstddef>
+#include <cstdint>
 #include <functional>
+#include <string>
 
 #include "base/gfx/color.h"
 
@@ -29,13 +32,35 @@ public:
 	bool operator==(const ColorTransform &other) const;
 
 private:
+	friend struct std::hash<ColorTransform>;
+
+	// the simple transforms are kept as parameters, so creating them
+	// does not allocate, only the combined ones need a function
+	enum class Type : std::uint8_t {
+		combined,
+		none,
+		color,
+		grayscale,
+		lightness,
+		opacity
+	};
+
 	using Convert = std::function<Color(const Color &)>;
-	std::string code;
+	Type type{Type::combined};
+	Color color;
+	double factor{};
 	Convert convert;
 
-	ColorTransform(Convert convert, std::string code);
+	ColorTransform(Type type, Color color, double factor);
+	explicit ColorTransform(Convert convert);
 };
 
 }
 
+template <> struct std::hash<Gfx::ColorTransform>
+{
+	std::size_t operator()(
+	    const Gfx::ColorTransform &transform) const noexcept;
+};
+
 #endif
@@ -1,7 +1,10 @@
 #include "font.h"
 
+#include <functional>
+#include <mutex>
+#include <set>
 #include <string>
-#include <utility>
+#include <string_view>
 
 #include "base/conv/parse.h"
 #include "base/conv/tostring.h"
@@ -9,6 +12,27 @@
 namespace Gfx
 {
 
+namespace
+{
+
+std::string_view intern(std::string_view family)
+{
+	if (family.empty()) return {};
+
+	thread_local std::string_view last;
+	if (family == last) return last;
+
+	static std::mutex mutex;
+	static std::set<std::string, std::less<>> families;
+
+	const std::lock_guard lock{mutex};
+	auto it = families.find(family);
+	if (it == families.end()) it = families.emplace(family).first;
+	return last = *it;
+}
+
+}
+
 Font::Weight Font::Weight::fromString(const std::string &str)
 {
 	if (str == "normal") return Normal();
@@ -42,11 +66,11 @@ bool Font::Weight::operator==(const Font::Weight &other) const
 Font::Font(double size) : style(Gfx::Font::Style::normal), size(size)
 {}
 
-Font::Font(std::string family,
+Font::Font(std::string_view family,
     Style style,
     Weight weight,
     double size) :
-    family(std::move(family)),
+    family(intern(family)),
     style(style),
     weight(weight),
     size(size)
@@ -3,6 +3,7 @@
 
 #include <cstdint>
 #include <string>
+#include <string_view>
 
 namespace Gfx
 {
@@ -30,13 +31,18 @@ public:
 
 	enum class Style : std::uint8_t { normal, italic, oblique };
 
-	std::string family;
+	// interned for the lifetime of the process, so fonts are cheap to
+	// create and to copy
+	std::string_view family;
 	Style style;
 	Weight weight;
 	double size;
 
 	explicit Font(double size = 0);
-	Font(std::string family, Style style, Weight weight, double size);
+	Font(std::string_view family,
+	    Style style,
+	    Weight weight,
+	    double size);
 	Font(const Font &) = default;
 	Font(Font &&) = default;
 	Font &operator=(const Font &) = default;
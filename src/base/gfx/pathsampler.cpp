@@ -1,7 +1,10 @@
 #include "pathsampler.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
+#include <utility>
 
 #include "base/geom/point.h"
 #include "base/geom/triangle.h"
@@ -10,47 +13,46 @@
 namespace Gfx
 {
 
-void PathSampler::calc()
+std::size_t PathSampler::depthBudget(
+    const std::array<Geom::Point, 5> &coarse) const
 {
-	auto point0 = getPoint(0.0);
-	auto point1 = getPoint(1.0);
+	constexpr static std::size_t maxRecursion = 20;
+	constexpr static std::size_t margin = 3;
 
-	addPoint(point0);
-	path(point0, point1, 0.0, 1.0);
-	addPoint(point1);
-}
+	if (options.distanceMax <= 0) return maxRecursion;
 
-void PathSampler::path(const Geom::Point &pConv0,
-    const Geom::Point &pConv1,
-    double i0,
-    double i1,
-    size_t recurseCnt)
-{
-	constexpr static size_t maxRecursion = 20;
-	if (recurseCnt >= maxRecursion) return;
+	auto length = 0.0;
+	for (auto i = 1U; i < coarse.size(); ++i)
+		length += (coarse[i] - coarse[i - 1]).abs();
 
-	const auto i = (i0 + i1) / 2.0;
-	const auto pConv = getPoint(i);
+	auto samples = length / std::sqrt(options.distanceMax);
+	if (!std::isfinite(samples)) return maxRecursion;
+	if (samples <= 1.0) return margin;
+
+	return std::min(
+	    static_cast<std::size_t>(std::ceil(std::log2(samples)))
+	        + margin,
+	    maxRecursion);
+}
 
-	const auto area = Geom::Triangle{{pConv0, pConv, pConv1}}.area();
-	const auto sqrLength = (pConv1 - pConv0).sqrAbs();
+std::pair<bool, bool> PathSampler::needSplit(const Geom::Point &p0,
+    const Geom::Point &p,
+    const Geom::Point &p1) const
+{
+	const auto area = Geom::Triangle{{p0, p, p1}}.area();
+	const auto sqrLength = (p1 - p0).sqrAbs();
 	const auto height = Math::Floating::is_zero(sqrLength)
 	                      ? 0.0
 	                      : 2 * area / sqrt(sqrLength);
 
-	const auto sqrAbs0 = (pConv - pConv0).sqrAbs();
-	const auto sqrAbs1 = (pConv - pConv1).sqrAbs();
+	const auto sqrAbs0 = (p - p0).sqrAbs();
+	const auto sqrAbs1 = (p - p1).sqrAbs();
 
 	auto needMore = height > options.curveHeightMax
 	             || sqrLength < sqrAbs0 || sqrLength < sqrAbs1;
 
-	if (needMore && sqrAbs0 > options.distanceMax)
-		path(pConv0, pConv, i0, i, recurseCnt + 1);
-
-	addPoint(pConv);
-
-	if (needMore && sqrAbs1 > options.distanceMax)
-		path(pConv, pConv1, i, i1, recurseCnt + 1);
+	return {needMore && sqrAbs0 > options.distanceMax,
+	    needMore && sqrAbs1 > options.distanceMax};
 }
 
-}
\ No newline at end of file
+}
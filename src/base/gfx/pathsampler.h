@@ -1,7 +1,11 @@
 #ifndef GFX_PATHSAMPLER
 #define GFX_PATHSAMPLER
 
+#include <array>
 #include <cstddef>
+#include <limits>
+#include <utility>
+#include <vector>
 
 #include "base/geom/point.h"
 
@@ -18,24 +22,87 @@ public:
 	};
 	explicit PathSampler(const Options &options) : options(options) {}
 
-	virtual ~PathSampler() = default;
+	[[nodiscard]] const Options &getOptions() const
+	{
+		return options;
+	}
+	void setOptions(const Options &options)
+	{
+		this->options = options;
+	}
 
-protected:
-	Options options;
+	template <class GetPoint>
+	void sample(const GetPoint &getPoint,
+	    std::vector<Geom::Point> &points);
+
+private:
+	static constexpr std::size_t emitPoint =
+	    std::numeric_limits<std::size_t>::max();
 
-	virtual void addPoint(const Geom::Point &) = 0;
-	virtual Geom::Point getPoint(double f) = 0;
+	struct Segment
+	{
+		Geom::Point p0;
+		Geom::Point p1;
+		double i0;
+		double i1;
+		std::size_t depth;
+	};
 
-	void calc();
+	Options options;
+	std::vector<Segment> stack;
 
-private:
-	void path(const Geom::Point &pConv0,
-	    const Geom::Point &pConv1,
-	    double i0,
-	    double i1,
-	    size_t recurseCnt = 0);
+	[[nodiscard]] std::size_t depthBudget(
+	    const std::array<Geom::Point, 5> &coarse) const;
+
+	[[nodiscard]] std::pair<bool, bool> needSplit(
+	    const Geom::Point &p0,
+	    const Geom::Point &p,
+	    const Geom::Point &p1) const;
 };
 
+template <class GetPoint>
+void PathSampler::sample(const GetPoint &getPoint,
+    std::vector<Geom::Point> &points)
+{
+	auto point0 = getPoint(0.0);
+	auto point1 = getPoint(1.0);
+
+	auto maxDepth = depthBudget({point0,
+	    getPoint(0.25),
+	    getPoint(0.5),
+	    getPoint(0.75),
+	    point1});
+
+	points.push_back(point0);
+
+	stack.clear();
+	stack.push_back({point0, point1, 0.0, 1.0, 0});
+	while (!stack.empty()) {
+		auto segment = stack.back();
+		stack.pop_back();
+
+		if (segment.depth == emitPoint) {
+			points.push_back(segment.p0);
+			continue;
+		}
+		if (segment.depth >= maxDepth) continue;
+
+		const auto i = (segment.i0 + segment.i1) / 2.0;
+		const auto point = getPoint(i);
+		auto [left, right] = needSplit(segment.p0, point, segment.p1);
+
+		if (right)
+			stack.push_back(
+			    {point, segment.p1, i, segment.i1, segment.depth + 1});
+		stack.push_back({point, point, i, i, emitPoint});
+		if (left)
+			stack.push_back(
+			    {segment.p0, point, segment.i0, i, segment.depth + 1});
+	}
+
+	points.push_back(point1);
+}
+
 }
 
 #endif
@@ -0,0 +1,968 @@
+#include "rastercanvas.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cmath>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <numbers>
+#include <span>
+#include <stop_token>
+#include <string>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "base/geom/affinetransform.h"
+#include "base/geom/circle.h"
+#include "base/geom/line.h"
+#include "base/geom/point.h"
+#include "base/geom/rect.h"
+
+#include "color.h"
+#include "font.h"
+#include "lineargradient.h"
+
+namespace Gfx
+{
+
+namespace
+{
+
+constexpr std::size_t glyphRows = 7;
+constexpr std::size_t glyphColumns = 5;
+constexpr double glyphAdvance = 6.0;
+constexpr double glyphTop = 1.5;
+constexpr double unitsPerEm = 10.0;
+
+// printable ASCII from the space, one byte per row, 0x10 is the
+// leftmost column
+constexpr std::array<std::uint8_t, 95 * glyphRows> glyphs{
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // ' '
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x00, 0x04, // '!'
+	0x0a, 0x0a, 0x0a, 0x00, 0x00, 0x00, 0x00, // '"'
+	0x0a, 0x0a, 0x1f, 0x0a, 0x1f, 0x0a, 0x0a, // '#'
+	0x04, 0x0f, 0x14, 0x0e, 0x05, 0x1e, 0x04, // '$'
+	0x18, 0x19, 0x02, 0x04, 0x08, 0x13, 0x03, // '%'
+	0x0c, 0x12, 0x14, 0x08, 0x15, 0x12, 0x0d, // '&'
+	0x04, 0x04, 0x04, 0x00, 0x00, 0x00, 0x00, // "'"
+	0x02, 0x04, 0x08, 0x08, 0x08, 0x04, 0x02, // '('
+	0x08, 0x04, 0x02, 0x02, 0x02, 0x04, 0x08, // ')'
+	0x00, 0x04, 0x15, 0x0e, 0x15, 0x04, 0x00, // '*'
+	0x00, 0x04, 0x04, 0x1f, 0x04, 0x04, 0x00, // '+'
+	0x00, 0x00, 0x00, 0x00, 0x0c, 0x04, 0x08, // ','
+	0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, // '-'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0x0c, // '.'
+	0x00, 0x01, 0x02, 0x04, 0x08, 0x10, 0x00, // '/'
+	0x0e, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0e, // '0'
+	0x04, 0x0c, 0x04, 0x04, 0x04, 0x04, 0x0e, // '1'
+	0x0e, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1f, // '2'
+	0x1f, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0e, // '3'
+	0x02, 0x06, 0x0a, 0x12, 0x1f, 0x02, 0x02, // '4'
+	0x1f, 0x10, 0x1e, 0x01, 0x01, 0x11, 0x0e, // '5'
+	0x06, 0x08, 0x10, 0x1e, 0x11, 0x11, 0x0e, // '6'
+	0x1f, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08, // '7'
+	0x0e, 0x11, 0x11, 0x0e, 0x11, 0x11, 0x0e, // '8'
+	0x0e, 0x11, 0x11, 0x0f, 0x01, 0x02, 0x0c, // '9'
+	0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x0c, 0x00, // ':'
+	0x00, 0x0c, 0x0c, 0x00, 0x0c, 0x04, 0x08, // ';'
+	0x02, 0x04, 0x08, 0x10, 0x08, 0x04, 0x02, // '<'
+	0x00, 0x00, 0x1f, 0x00, 0x1f, 0x00, 0x00, // '='
+	0x08, 0x04, 0x02, 0x01, 0x02, 0x04, 0x08, // '>'
+	0x0e, 0x11, 0x01, 0x02, 0x04, 0x00, 0x04, // '?'
+	0x0e, 0x11, 0x01, 0x0d, 0x15, 0x15, 0x0e, // '@'
+	0x0e, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, // 'A'
+	0x1e, 0x11, 0x11, 0x1e, 0x11, 0x11, 0x1e, // 'B'
+	0x0e, 0x11, 0x10, 0x10, 0x10, 0x11, 0x0e, // 'C'
+	0x1c, 0x12, 0x11, 0x11, 0x11, 0x12, 0x1c, // 'D'
+	0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x1f, // 'E'
+	0x1f, 0x10, 0x10, 0x1e, 0x10, 0x10, 0x10, // 'F'
+	0x0e, 0x11, 0x10, 0x17, 0x11, 0x11, 0x0f, // 'G'
+	0x11, 0x11, 0x11, 0x1f, 0x11, 0x11, 0x11, // 'H'
+	0x0e, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, // 'I'
+	0x07, 0x02, 0x02, 0x02, 0x02, 0x12, 0x0c, // 'J'
+	0x11, 0x12, 0x14, 0x18, 0x14, 0x12, 0x11, // 'K'
+	0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x1f, // 'L'
+	0x11, 0x1b, 0x15, 0x15, 0x11, 0x11, 0x11, // 'M'
+	0x11, 0x11, 0x19, 0x15, 0x13, 0x11, 0x11, // 'N'
+	0x0e, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, // 'O'
+	0x1e, 0x11, 0x11, 0x1e, 0x10, 0x10, 0x10, // 'P'
+	0x0e, 0x11, 0x11, 0x11, 0x15, 0x12, 0x0d, // 'Q'
+	0x1e, 0x11, 0x11, 0x1e, 0x14, 0x12, 0x11, // 'R'
+	0x0f, 0x10, 0x10, 0x0e, 0x01, 0x01, 0x1e, // 'S'
+	0x1f, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, // 'T'
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x0e, // 'U'
+	0x11, 0x11, 0x11, 0x11, 0x11, 0x0a, 0x04, // 'V'
+	0x11, 0x11, 0x11, 0x15, 0x15, 0x15, 0x0a, // 'W'
+	0x11, 0x11, 0x0a, 0x04, 0x0a, 0x11, 0x11, // 'X'
+	0x11, 0x11, 0x11, 0x0a, 0x04, 0x04, 0x04, // 'Y'
+	0x1f, 0x01, 0x02, 0x04, 0x08, 0x10, 0x1f, // 'Z'
+	0x0e, 0x08, 0x08, 0x08, 0x08, 0x08, 0x0e, // '['
+	0x00, 0x10, 0x08, 0x04, 0x02, 0x01, 0x00, // '\\'
+	0x0e, 0x02, 0x02, 0x02, 0x02, 0x02, 0x0e, // ']'
+	0x04, 0x0a, 0x11, 0x00, 0x00, 0x00, 0x00, // '^'
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, // '_'
+	0x08, 0x04, 0x02, 0x00, 0x00, 0x00, 0x00, // '`'
+	0x00, 0x00, 0x0e, 0x01, 0x0f, 0x11, 0x0f, // 'a'
+	0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x1e, // 'b'
+	0x00, 0x00, 0x0e, 0x10, 0x10, 0x11, 0x0e, // 'c'
+	0x01, 0x01, 0x0d, 0x13, 0x11, 0x11, 0x0f, // 'd'
+	0x00, 0x00, 0x0e, 0x11, 0x1f, 0x10, 0x0e, // 'e'
+	0x06, 0x09, 0x08, 0x1c, 0x08, 0x08, 0x08, // 'f'
+	0x00, 0x0f, 0x11, 0x11, 0x0f, 0x01, 0x0e, // 'g'
+	0x10, 0x10, 0x16, 0x19, 0x11, 0x11, 0x11, // 'h'
+	0x04, 0x00, 0x0c, 0x04, 0x04, 0x04, 0x0e, // 'i'
+	0x02, 0x00, 0x06, 0x02, 0x02, 0x12, 0x0c, // 'j'
+	0x10, 0x10, 0x12, 0x14, 0x18, 0x14, 0x12, // 'k'
+	0x0c, 0x04, 0x04, 0x04, 0x04, 0x04, 0x0e, // 'l'
+	0x00, 0x00, 0x1a, 0x15, 0x15, 0x11, 0x11, // 'm'
+	0x00, 0x00, 0x16, 0x19, 0x11, 0x11, 0x11, // 'n'
+	0x00, 0x00, 0x0e, 0x11, 0x11, 0x11, 0x0e, // 'o'
+	0x00, 0x00, 0x1e, 0x11, 0x1e, 0x10, 0x10, // 'p'
+	0x00, 0x00, 0x0d, 0x13, 0x0f, 0x01, 0x01, // 'q'
+	0x00, 0x00, 0x16, 0x19, 0x10, 0x10, 0x10, // 'r'
+	0x00, 0x00, 0x0e, 0x10, 0x0e, 0x01, 0x1e, // 's'
+	0x08, 0x08, 0x1c, 0x08, 0x08, 0x09, 0x06, // 't'
+	0x00, 0x00, 0x11, 0x11, 0x11, 0x13, 0x0d, // 'u'
+	0x00, 0x00, 0x11, 0x11, 0x11, 0x0a, 0x04, // 'v'
+	0x00, 0x00, 0x11, 0x11, 0x15, 0x15, 0x0a, // 'w'
+	0x00, 0x00, 0x11, 0x0a, 0x04, 0x0a, 0x11, // 'x'
+	0x00, 0x00, 0x11, 0x11, 0x0f, 0x01, 0x0e, // 'y'
+	0x00, 0x00, 0x1f, 0x02, 0x04, 0x08, 0x1f, // 'z'
+	0x02, 0x04, 0x04, 0x08, 0x04, 0x04, 0x02, // '{'
+	0x04, 0x04, 0x04, 0x04, 0x04, 0x04, 0x04, // '|'
+	0x08, 0x04, 0x04, 0x02, 0x04, 0x04, 0x08, // '}'
+	0x00, 0x00, 0x08, 0x15, 0x02, 0x00, 0x00, // '~'
+};
+
+std::size_t glyphIndex(unsigned char c)
+{
+	return c >= ' ' && c <= '~' ? c - ' ' : '?' - ' ';
+}
+
+bool isContinuation(unsigned char c) { return (c & 0xC0U) == 0x80U; }
+
+std::uint8_t toByte(double value)
+{
+	return static_cast<std::uint8_t>(
+	    std::lround(std::clamp(value, 0.0, 1.0) * 255.0));
+}
+
+std::size_t toIndex(double value, std::size_t limit)
+{
+	return static_cast<std::size_t>(
+	    std::clamp(value, 0.0, static_cast<double>(limit)));
+}
+
+}
+
+class RasterCanvas::Tile final : public RasterCanvas
+{
+public:
+	using RasterCanvas::RasterCanvas;
+	void *getPainter() final { return nullptr; }
+};
+
+// Threads running the tile work of drawTiles() together with the
+// calling thread; kept between the calls, so a frame does not pay
+// for starting them.
+class RasterCanvas::Workers
+{
+public:
+	explicit Workers(std::size_t count)
+	{
+		threads.reserve(count);
+		for (auto i = 0U; i < count; ++i)
+			threads.emplace_back(
+			    [this](const std::stop_token &stop)
+			    {
+				    loop(stop);
+			    });
+	}
+
+	[[nodiscard]] std::size_t size() const { return threads.size(); }
+
+	void run(const std::function<void()> &work)
+	{
+		{
+			const std::lock_guard lock{mutex};
+			job = &work;
+			running = threads.size();
+			++generation;
+		}
+		wake.notify_all();
+		work();
+		std::unique_lock lock{mutex};
+		done.wait(lock,
+		    [this]
+		    {
+			    return running == 0;
+		    });
+	}
+
+private:
+	std::mutex mutex;
+	std::condition_variable_any wake;
+	std::condition_variable done;
+	const std::function<void()> *job{};
+	std::size_t generation{};
+	std::size_t running{};
+	std::vector<std::jthread> threads;
+
+	void loop(const std::stop_token &stop)
+	{
+		std::size_t seen{};
+		std::unique_lock lock{mutex};
+		while (wake.wait(lock,
+		    stop,
+		    [this, &seen]
+		    {
+			    return generation != seen;
+		    })) {
+			seen = generation;
+			const auto &work = *job;
+			lock.unlock();
+			work();
+			lock.lock();
+			if (--running == 0) done.notify_one();
+		}
+	}
+};
+
+RasterCanvas::RasterCanvas(std::size_t width, std::size_t height) :
+    width(width),
+    height(height),
+    pixels(width * height * 4),
+    states(1)
+{}
+
+RasterCanvas::~RasterCanvas() = default;
+
+void RasterCanvas::resize(std::size_t width, std::size_t height)
+{
+	this->width = width;
+	this->height = height;
+	pixels.assign(width * height * 4, 0);
+	states.assign(1, State{});
+	polygon.clear();
+}
+
+void RasterCanvas::setTiling(std::size_t tileSize,
+    std::size_t threads)
+{
+	this->tileSize = tileSize;
+	if (this->threads != threads) workers.reset();
+	this->threads = threads;
+}
+
+Color RasterCanvas::getPixel(std::size_t x, std::size_t y) const
+{
+	const auto *pixel = pixels.data() + (y * width + x) * 4;
+	return {pixel[0] / 255.0,
+	    pixel[1] / 255.0,
+	    pixel[2] / 255.0,
+	    pixel[3] / 255.0};
+}
+
+Geom::Size RasterCanvas::textSize(const Font &font,
+    const std::string &text)
+{
+	auto count = std::ranges::count_if(text,
+	    [](char c)
+	    {
+		    return !isContinuation(static_cast<unsigned char>(c));
+	    });
+	return {static_cast<double>(count) * glyphAdvance * font.size
+	            / unitsPerEm,
+	    font.size};
+}
+
+void RasterCanvas::setClipRect(const Geom::Rect &rect)
+{
+	shape.clear();
+	rectPath(shape, rect);
+	clipPath(shape);
+}
+
+void RasterCanvas::setClipCircle(const Geom::Circle &circle)
+{
+	shape.clear();
+	circlePath(shape, circle);
+	clipPath(shape);
+}
+
+void RasterCanvas::setClipPolygon()
+{
+	polygon.close();
+	clipPath(polygon);
+	polygon.clear();
+}
+
+void RasterCanvas::setBrushColor(const Color &color)
+{
+	state().brushColor = color;
+	state().brushGradient.reset();
+}
+
+void RasterCanvas::setLineColor(const Color &color)
+{
+	state().lineColor = color;
+}
+
+void RasterCanvas::setLineWidth(double width)
+{
+	state().lineWidth = width;
+}
+
+void RasterCanvas::setFont(const Font &font) { state().font = font; }
+
+void RasterCanvas::transform(const Geom::AffineTransform &transform)
+{
+	state().transform *= transform;
+}
+
+void RasterCanvas::save() { states.push_back(states.back()); }
+
+void RasterCanvas::restore()
+{
+	if (states.size() > 1) states.pop_back();
+}
+
+void RasterCanvas::beginDropShadow()
+{
+	state().shadow.emplace(Shadow{Color{}, {}, 0.0});
+}
+
+void RasterCanvas::setDropShadowBlur(double radius)
+{
+	if (auto &shadow = state().shadow) shadow->blur = radius;
+}
+
+void RasterCanvas::setDropShadowColor(const Color &color)
+{
+	if (auto &shadow = state().shadow) shadow->color = color;
+}
+
+void RasterCanvas::setDropShadowOffset(const Geom::Point &offset)
+{
+	if (auto &shadow = state().shadow) shadow->offset = offset;
+}
+
+void RasterCanvas::endDropShadow() { state().shadow.reset(); }
+
+void RasterCanvas::beginPolygon() { polygon.clear(); }
+
+void RasterCanvas::addPoint(const Geom::Point &point)
+{
+	polygon.points.push_back(device(point));
+}
+
+void RasterCanvas::addBezier(const Geom::Point &control0,
+    const Geom::Point &control1,
+    const Geom::Point &endPoint)
+{
+	bezierPath(polygon, control0, control1, endPoint);
+}
+
+void RasterCanvas::endPolygon()
+{
+	polygon.close();
+	fillPath(polygon);
+	strokePath(polygon, true);
+	polygon.clear();
+}
+
+void RasterCanvas::rectangle(const Geom::Rect &rect)
+{
+	shape.clear();
+	rectPath(shape, rect);
+	fillPath(shape);
+	strokePath(shape, true);
+}
+
+void RasterCanvas::circle(const Geom::Circle &circle)
+{
+	shape.clear();
+	circlePath(shape, circle);
+	fillPath(shape);
+	strokePath(shape, true);
+}
+
+void RasterCanvas::line(const Geom::Line &line)
+{
+	shape.clear();
+	shape.points.push_back(device(line.begin));
+	shape.points.push_back(device(line.end));
+	shape.close();
+	strokePath(shape, false);
+}
+
+bool RasterCanvas::rectangles(std::span<const Geom::Rect> rects,
+    std::span<const Color> brushColors,
+    std::span<const Color> lineColors)
+{
+	for (auto i = 0U; i < rects.size(); ++i) {
+		setBrushColor(brushColors[i]);
+		setLineColor(lineColors[i]);
+		rectangle(rects[i]);
+	}
+	return true;
+}
+
+bool RasterCanvas::circles(std::span<const Geom::Circle> circles,
+    std::span<const Color> brushColors,
+    std::span<const Color> lineColors)
+{
+	for (auto i = 0U; i < circles.size(); ++i) {
+		setBrushColor(brushColors[i]);
+		setLineColor(lineColors[i]);
+		circle(circles[i]);
+	}
+	return true;
+}
+
+ICanvas::TileGrid RasterCanvas::tileGrid() const
+{
+	const auto &[r0, r1] = state().transform.getMatrix();
+	if (tileSize == 0 || r0[1] != 0 || r1[0] != 0 || r0[0] <= 0
+	    || r1[1] <= 0 || state().shadow)
+		return {};
+
+	auto columns = (width + tileSize - 1) / tileSize;
+	auto rows = (height + tileSize - 1) / tileSize;
+	if (columns * rows < 2) return {};
+
+	auto size = static_cast<double>(tileSize);
+	return {{-r0[2] / r0[0], -r1[2] / r1[1]},
+	    {size / r0[0], size / r1[1]},
+	    columns,
+	    rows};
+}
+
+bool RasterCanvas::drawTiles(
+    const std::function<void(std::size_t, ICanvas &)> &drawTile)
+{
+	auto grid = tileGrid();
+	auto count = grid.columns * grid.rows;
+	if (count == 0) return false;
+
+	tiles.resize(count);
+
+	std::atomic<std::size_t> next{};
+	const std::function<void()> work =
+	    [this, &grid, &drawTile, &next, count]
+	{
+		for (auto index = next++; index < count; index = next++)
+			renderTile(index, grid, drawTile);
+	};
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+	work();
+#else
+	if (!workers)
+		workers = std::make_unique<Workers>(
+		    (threads != 0 ? threads
+		                  : std::max<std::size_t>(1,
+		                      std::thread::hardware_concurrency()))
+		    - 1);
+	if (workers->size() == 0)
+		work();
+	else
+		workers->run(work);
+#endif
+	return true;
+}
+
+void RasterCanvas::text(const Geom::Rect &rect, const std::string &text)
+{
+	const auto &font = state().font;
+	auto unit = font.size / unitsPerEm;
+	auto bold = static_cast<int>(font.weight)
+	                 >= static_cast<int>(Font::Weight::Bold())
+	             ? 0.35 * unit
+	             : 0.0;
+
+	auto pos = rect.pos;
+	if (rect.size.x < 0) pos.x -= rect.size.x;
+	if (rect.size.y < 0) pos.y -= rect.size.y;
+
+	shape.clear();
+	for (auto c : text) {
+		auto byte = static_cast<unsigned char>(c);
+		if (isContinuation(byte)) continue;
+
+		const auto *glyph = glyphs.data() + glyphIndex(byte) * glyphRows;
+		for (auto row = 0U; row < glyphRows; ++row)
+			for (auto column = 0U; column < glyphColumns; ++column)
+				if ((glyph[row] & (0x10U >> column)) != 0) {
+					rectPath(shape,
+					    {{pos.x + column * unit,
+					         pos.y + (glyphTop + row) * unit},
+					        {unit + bold, unit}});
+					shape.close(true);
+				}
+
+		pos.x += glyphAdvance * unit;
+	}
+	fillPath(shape);
+}
+
+void RasterCanvas::setBrushGradient(const LinearGradient &gradient)
+{
+	state().brushGradient = gradient;
+}
+
+void RasterCanvas::frameBegin()
+{
+	std::ranges::fill(pixels, 0);
+	states.assign(1, State{});
+	polygon.clear();
+}
+
+void RasterCanvas::Path::clear()
+{
+	points.clear();
+	ends.clear();
+}
+
+void RasterCanvas::Path::close(bool orient)
+{
+	auto begin = ends.empty() ? 0 : ends.back();
+	if (points.size() == begin) return;
+
+	if (orient) {
+		auto area = 0.0;
+		for (auto i = begin; i < points.size(); ++i) {
+			const auto &next =
+			    points[i + 1 < points.size() ? i + 1 : begin];
+			area += points[i].x * next.y - next.x * points[i].y;
+		}
+		if (area < 0)
+			std::reverse(std::next(points.begin(),
+			                 static_cast<std::ptrdiff_t>(begin)),
+			    points.end());
+	}
+	ends.push_back(points.size());
+}
+
+Color RasterCanvas::Paint::at(const Geom::Point &pixel) const
+{
+	if (!gradient) return color;
+
+	auto point = inverse(pixel);
+	auto direction = gradient->line.getDirection();
+	auto length = direction.sqrAbs();
+	auto factor =
+	    length > 0
+	        ? (point - gradient->line.begin).dot(direction) / length
+	        : 0.0;
+	return gradient->colors(std::clamp(factor, 0.0, 1.0));
+}
+
+Geom::Point RasterCanvas::device(const Geom::Point &point) const
+{
+	return state().transform(point);
+}
+
+double RasterCanvas::deviceScale() const
+{
+	const auto &[r0, r1] = state().transform.getMatrix();
+	return std::sqrt(std::abs(r0[0] * r1[1] - r0[1] * r1[0]));
+}
+
+RasterCanvas::Paint RasterCanvas::brush() const
+{
+	Paint res{state().brushColor, nullptr, {}};
+	if (state().brushGradient && deviceScale() > 0) {
+		res.gradient = &*state().brushGradient;
+		res.inverse = state().transform.inverse();
+	}
+	return res;
+}
+
+void RasterCanvas::rectPath(Path &path, const Geom::Rect &rect) const
+{
+	path.points.push_back(device(rect.bottomLeft()));
+	path.points.push_back(device(rect.bottomRight()));
+	path.points.push_back(device(rect.topRight()));
+	path.points.push_back(device(rect.topLeft()));
+	path.close();
+}
+
+void RasterCanvas::circlePath(Path &path,
+    const Geom::Circle &circle) const
+{
+	auto radius = circle.radius * deviceScale();
+	auto count = static_cast<std::size_t>(
+	    std::clamp(std::ceil(std::numbers::pi * radius), 12.0, 256.0));
+	for (auto i = 0U; i < count; ++i)
+		path.points.push_back(device(circle.center
+		                             + Geom::Point::Polar(circle.radius,
+		                                 2.0 * std::numbers::pi * i
+		                                     / static_cast<double>(
+		                                         count))));
+	path.close(true);
+}
+
+void RasterCanvas::bezierPath(Path &path,
+    const Geom::Point &control0,
+    const Geom::Point &control1,
+    const Geom::Point &endPoint) const
+{
+	auto p1 = device(control0);
+	auto p2 = device(control1);
+	auto p3 = device(endPoint);
+
+	if (path.points.size() == (path.ends.empty() ? 0 : path.ends.back()))
+		path.points.push_back(p1);
+	auto p0 = path.points.back();
+
+	auto length = (p1 - p0).abs() + (p2 - p1).abs() + (p3 - p2).abs();
+	auto count = static_cast<std::size_t>(
+	    std::clamp(std::ceil(length / 4.0), 2.0, 64.0));
+	for (auto i = 1U; i <= count; ++i) {
+		auto t = static_cast<double>(i) / static_cast<double>(count);
+		auto u = 1.0 - t;
+		path.points.push_back(p0 * (u * u * u) + p1 * (3 * u * u * t)
+		                      + p2 * (3 * u * t * t) + p3 * (t * t * t));
+	}
+}
+
+void RasterCanvas::strokeOutline(const Path &path, bool closed)
+{
+	auto halfWidth = state().lineWidth * deviceScale() / 2.0;
+	auto joinCount = static_cast<std::size_t>(
+	    std::clamp(std::ceil(halfWidth * 2.0), 8.0, 32.0));
+
+	outline.clear();
+	std::size_t begin{};
+	for (auto end : path.ends) {
+		for (auto i = begin; i < end; ++i) {
+			auto last = i + 1 == end;
+			if (last && !closed) break;
+
+			const auto &p0 = path.points[i];
+			const auto &p1 = path.points[last ? begin : i + 1];
+			auto length = (p1 - p0).abs();
+			if (length <= 0) continue;
+
+			auto normal = (p1 - p0).rightNormal() * (halfWidth / length);
+			outline.points.insert(outline.points.end(),
+			    {p0 + normal, p1 + normal, p1 - normal, p0 - normal});
+			outline.close(true);
+		}
+
+		if (halfWidth > 0.5)
+			for (auto i = begin; i < end; ++i) {
+				if (!closed && (i == begin || i + 1 == end)) continue;
+				for (auto j = 0U; j < joinCount; ++j)
+					outline.points.push_back(path.points[i]
+					                         + Geom::Point::Polar(halfWidth,
+					                             2.0 * std::numbers::pi * j
+					                                 / static_cast<double>(
+					                                     joinCount)));
+				outline.close(true);
+			}
+
+		begin = end;
+	}
+}
+
+void RasterCanvas::fillPath(const Path &path) { draw(path, brush()); }
+
+void RasterCanvas::strokePath(const Path &path, bool closed)
+{
+	if (state().lineWidth <= 0) return;
+	strokeOutline(path, closed);
+	draw(outline, Paint{state().lineColor, nullptr, {}});
+}
+
+void RasterCanvas::clipPath(const Path &path)
+{
+	auto mask = std::make_shared<std::vector<float>>(width * height);
+	if (rasterize(path)) {
+		const auto *clip = state().clip.get();
+		for (auto y = 0U; y < coverage.height; ++y)
+			for (auto x = 0U; x < coverage.width; ++x) {
+				auto index =
+				    (coverage.y0 + y) * width + coverage.x0 + x;
+				(*mask)[index] = static_cast<float>(
+				    coverage.values[y * coverage.width + x]
+				    * (clip ? (*clip)[index] : 1.0F));
+			}
+	}
+	state().clip = std::move(mask);
+}
+
+void RasterCanvas::draw(const Path &path, const Paint &paint)
+{
+	if (const auto &shadow = state().shadow;
+	    shadow && shadow->color.alpha > 0
+	    && rasterize(path,
+	        shadow->offset,
+	        static_cast<std::size_t>(
+	            std::clamp(std::ceil(shadow->blur / 2.0), 0.0, 64.0)))) {
+		auto color = shadow->color;
+		if (!paint.gradient) color.alpha *= paint.color.alpha;
+		composite(Paint{color, nullptr, {}});
+	}
+
+	if (rasterize(path)) composite(paint);
+}
+
+bool RasterCanvas::rasterize(const Path &path,
+    const Geom::Point &offset,
+    std::size_t blur)
+{
+	if (path.points.empty()) return false;
+
+	auto min = path.points.front();
+	auto max = min;
+	for (const auto &point : path.points) {
+		min.x = std::min(min.x, point.x);
+		min.y = std::min(min.y, point.y);
+		max.x = std::max(max.x, point.x);
+		max.y = std::max(max.y, point.y);
+	}
+	if (!std::isfinite(min.x) || !std::isfinite(min.y)
+	    || !std::isfinite(max.x) || !std::isfinite(max.y))
+		return false;
+
+	auto spread = static_cast<double>(blur);
+	auto x0 = toIndex(std::floor(min.x + offset.x - spread), width);
+	auto x1 = toIndex(std::ceil(max.x + offset.x + spread), width);
+	auto y0 = toIndex(std::floor(min.y + offset.y - spread), height);
+	auto y1 = toIndex(std::ceil(max.y + offset.y + spread), height);
+	if (x0 >= x1 || y0 >= y1) return false;
+
+	coverage.x0 = x0;
+	coverage.y0 = y0;
+	coverage.width = x1 - x0;
+	coverage.height = y1 - y0;
+
+	auto stride = coverage.width + 2;
+	accumulation.assign(stride * coverage.height, 0.0F);
+
+	auto origin = Geom::Point{static_cast<double>(x0),
+	                  static_cast<double>(y0)}
+	            - offset;
+	std::size_t begin{};
+	for (auto end : path.ends) {
+		for (auto i = begin; i < end; ++i)
+			addEdge(path.points[i] - origin,
+			    path.points[i + 1 < end ? i + 1 : begin] - origin);
+		begin = end;
+	}
+
+	coverage.values.resize(coverage.width * coverage.height);
+	for (auto y = 0U; y < coverage.height; ++y) {
+		auto sum = 0.0;
+		for (auto x = 0U; x < coverage.width; ++x) {
+			sum += accumulation[y * stride + x];
+			coverage.values[y * coverage.width + x] =
+			    std::min(1.0, std::abs(sum));
+		}
+	}
+
+	if (blur > 0) this->blur(blur);
+	return true;
+}
+
+void RasterCanvas::addEdge(Geom::Point p0, Geom::Point p1)
+{
+	auto right = static_cast<double>(coverage.width);
+
+	std::array<double, 4> cuts{0.0};
+	std::size_t count = 1;
+	if (auto dx = p1.x - p0.x; dx != 0)
+		for (auto border : {0.0, right})
+			if (auto cut = (border - p0.x) / dx; cut > 0 && cut < 1)
+				cuts[count++] = cut;
+	if (count == 3 && cuts[1] > cuts[2]) std::swap(cuts[1], cuts[2]);
+	cuts[count++] = 1.0;
+
+	auto at = [&](double factor)
+	{
+		auto point = p0 + (p1 - p0) * factor;
+		point.x = std::clamp(point.x, 0.0, right);
+		return point;
+	};
+	for (auto i = 1U; i < count; ++i)
+		accumulate(at(cuts[i - 1]), at(cuts[i]));
+}
+
+void RasterCanvas::accumulate(const Geom::Point &from,
+    const Geom::Point &to)
+{
+	if (from.y == to.y) return;
+
+	auto direction = from.y < to.y ? 1.0 : -1.0;
+	const auto &p0 = from.y < to.y ? from : to;
+	const auto &p1 = from.y < to.y ? to : from;
+
+	auto dxdy = (p1.x - p0.x) / (p1.y - p0.y);
+	auto x = p0.x;
+	if (p0.y < 0) x -= p0.y * dxdy;
+
+	auto stride = coverage.width + 2;
+	auto yBegin = toIndex(p0.y, coverage.height);
+	auto yEnd = toIndex(std::ceil(p1.y), coverage.height);
+	for (auto y = yBegin; y < yEnd; ++y) {
+		auto *row = accumulation.data() + y * stride;
+		auto rowTop = static_cast<double>(y);
+		auto dy =
+		    std::min(rowTop + 1.0, p1.y) - std::max(rowTop, p0.y);
+		auto xNext = std::clamp(x + dxdy * dy,
+		    0.0,
+		    static_cast<double>(coverage.width));
+		auto d = dy * direction;
+		auto [x0, x1] = std::minmax(x, xNext);
+		auto x0Floor = std::floor(x0);
+		auto x1Ceil = std::ceil(x1);
+		auto x0i = static_cast<std::size_t>(x0Floor);
+		auto x1i = static_cast<std::size_t>(x1Ceil);
+
+		auto add = [row](std::size_t index, double value)
+		{
+			row[index] += static_cast<float>(value);
+		};
+
+		if (x1i <= x0i + 1) {
+			auto xmf = 0.5 * (x + xNext) - x0Floor;
+			add(x0i, d - d * xmf);
+			add(x0i + 1, d * xmf);
+		}
+		else {
+			auto s = 1.0 / (x1 - x0);
+			auto x0f = x0 - x0Floor;
+			auto a0 = 0.5 * s * (1.0 - x0f) * (1.0 - x0f);
+			auto x1f = x1 - x1Ceil + 1.0;
+			auto am = 0.5 * s * x1f * x1f;
+			add(x0i, d * a0);
+			if (x1i == x0i + 2)
+				add(x0i + 1, d * (1.0 - a0 - am));
+			else {
+				auto a1 = s * (1.5 - x0f);
+				add(x0i + 1, d * (a1 - a0));
+				for (auto xi = x0i + 2; xi < x1i - 1; ++xi)
+					add(xi, d * s);
+				auto a2 = a1 + static_cast<double>(x1i - x0i - 3) * s;
+				add(x1i - 1, d * (1.0 - a2 - am));
+			}
+			add(x1i, d * am);
+		}
+		x = xNext;
+	}
+}
+
+void RasterCanvas::blur(std::size_t radius)
+{
+	auto w = coverage.width;
+	auto h = coverage.height;
+	auto &values = coverage.values;
+	auto window = static_cast<double>(2 * radius + 1);
+
+	blurred.resize(values.size());
+	for (auto y = 0U; y < h; ++y)
+		for (auto x = 0U; x < w; ++x) {
+			auto sum = 0.0;
+			for (auto i = x > radius ? x - radius : 0;
+			     i < std::min(w, x + radius + 1);
+			     ++i)
+				sum += values[y * w + i];
+			blurred[y * w + x] = sum / window;
+		}
+
+	for (auto y = 0U; y < h; ++y)
+		for (auto x = 0U; x < w; ++x) {
+			auto sum = 0.0;
+			for (auto i = y > radius ? y - radius : 0;
+			     i < std::min(h, y + radius + 1);
+			     ++i)
+				sum += blurred[i * w + x];
+			values[y * w + x] = sum / window;
+		}
+}
+
+void RasterCanvas::renderTile(std::size_t index,
+    const TileGrid &grid,
+    const std::function<void(std::size_t, ICanvas &)> &drawTile)
+{
+	auto x0 = index % grid.columns * tileSize;
+	auto y0 = index / grid.columns * tileSize;
+	auto tileWidth = std::min(tileSize, width - x0);
+	auto tileHeight = std::min(tileSize, height - y0);
+
+	auto &slot = tiles[index];
+	if (!slot) slot = std::make_unique<Tile>(tileWidth, tileHeight);
+	RasterCanvas &tile = *slot;
+	tile.resize(tileWidth, tileHeight);
+
+	auto rowSize = tileWidth * 4;
+	for (auto y = 0U; y < tileHeight; ++y)
+		std::copy_n(pixels.data() + ((y0 + y) * width + x0) * 4,
+		    rowSize,
+		    tile.pixels.data() + y * rowSize);
+
+	auto &tileState = tile.state();
+	tileState = state();
+	tileState.transform =
+	    Geom::AffineTransform{Geom::Point{-static_cast<double>(x0),
+	        -static_cast<double>(y0)}}
+	    * state().transform;
+	if (const auto *clip = state().clip.get()) {
+		auto mask =
+		    std::make_shared<std::vector<float>>(tileWidth * tileHeight);
+		for (auto y = 0U; y < tileHeight; ++y)
+			std::copy_n(clip->data() + (y0 + y) * width + x0,
+			    tileWidth,
+			    mask->data() + y * tileWidth);
+		tileState.clip = std::move(mask);
+	}
+
+	drawTile(index, tile);
+
+	for (auto y = 0U; y < tileHeight; ++y)
+		std::copy_n(tile.pixels.data() + y * rowSize,
+		    rowSize,
+		    pixels.data() + ((y0 + y) * width + x0) * 4);
+}
+
+void RasterCanvas::composite(const Paint &paint)
+{
+	const auto *clip = state().clip.get();
+	for (auto y = 0U; y < coverage.height; ++y)
+		for (auto x = 0U; x < coverage.width; ++x) {
+			auto cover = coverage.values[y * coverage.width + x];
+			auto px = coverage.x0 + x;
+			auto py = coverage.y0 + y;
+			auto index = py * width + px;
+			if (clip) cover *= (*clip)[index];
+			if (cover <= 0) continue;
+
+			auto color = paint.at({static_cast<double>(px) + 0.5,
+			    static_cast<double>(py) + 0.5});
+			auto alpha = std::clamp(color.alpha, 0.0, 1.0) * cover;
+			if (alpha <= 0) continue;
+
+			auto *pixel = pixels.data() + index * 4;
+			auto below = pixel[3] / 255.0 * (1.0 - alpha);
+			auto total = alpha + below;
+			auto mix = [&](double source, std::uint8_t target)
+			{
+				return (source * alpha + target / 255.0 * below)
+				     / total;
+			};
+			pixel[0] = toByte(mix(color.red, pixel[0]));
+			pixel[1] = toByte(mix(color.green, pixel[1]));
+			pixel[2] = toByte(mix(color.blue, pixel[2]));
+			pixel[3] = toByte(total);
+		}
+}
+
+}
@@ -0,0 +1,202 @@
+#ifndef GFX_RASTERCANVAS_H
+#define GFX_RASTERCANVAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+#include "canvas.h"
+
+namespace Gfx
+{
+
+// Dependency free software canvas rendering into an RGBA buffer of
+// straight alpha, row major 8 bit channels. Text is drawn with a
+// built-in 5x7 bitmap font.
+class RasterCanvas : public ICanvas
+{
+public:
+	RasterCanvas(std::size_t width, std::size_t height);
+	~RasterCanvas() override;
+
+	void resize(std::size_t width, std::size_t height);
+
+	// tiled drawing is off by default; tileSize 0 disables it,
+	// threads 0 uses all cores. The worker threads are started on
+	// the first tiled draw and kept until the canvas is destroyed or
+	// the tiling is changed.
+	void setTiling(std::size_t tileSize, std::size_t threads = 0);
+
+	[[nodiscard]] std::size_t getWidth() const { return width; }
+	[[nodiscard]] std::size_t getHeight() const { return height; }
+	[[nodiscard]] const std::vector<std::uint8_t> &getPixels() const
+	{
+		return pixels;
+	}
+	[[nodiscard]] Color getPixel(std::size_t x, std::size_t y) const;
+
+	// Extent of the text drawn by text(). The chart lays out its
+	// labels with ICanvas::measureText(), which is defined by the
+	// embedding application, not by this canvas. A build rendering
+	// with RasterCanvas has to forward it here, otherwise the labels
+	// are placed for other metrics than they are drawn with:
+	//
+	//   Geom::Size Gfx::ICanvas::measureText(const Gfx::Font &font,
+	//       const std::string &text)
+	//   {
+	//       return Gfx::RasterCanvas::textSize(font, text);
+	//   }
+	[[nodiscard]] static Geom::Size textSize(const Font &font,
+	    const std::string &text);
+
+	void setClipRect(const Geom::Rect &rect) override;
+	void setClipCircle(const Geom::Circle &circle) override;
+	void setClipPolygon() override;
+	void setBrushColor(const Color &color) override;
+	void setLineColor(const Color &color) override;
+	void setLineWidth(double width) override;
+	void setFont(const Font &font) override;
+
+	void transform(const Geom::AffineTransform &transform) override;
+	void save() override;
+	void restore() override;
+	void beginDropShadow() override;
+	void setDropShadowBlur(double radius) override;
+	void setDropShadowColor(const Color &color) override;
+	void setDropShadowOffset(const Geom::Point &offset) override;
+	void endDropShadow() override;
+
+	void beginPolygon() override;
+	void addPoint(const Geom::Point &point) override;
+	void addBezier(const Geom::Point &control0,
+	    const Geom::Point &control1,
+	    const Geom::Point &endPoint) override;
+	void endPolygon() override;
+
+	void rectangle(const Geom::Rect &rect) override;
+	void circle(const Geom::Circle &circle) override;
+	void line(const Geom::Line &line) override;
+
+	bool rectangles(std::span<const Geom::Rect> rects,
+	    std::span<const Color> brushColors,
+	    std::span<const Color> lineColors) override;
+	bool circles(std::span<const Geom::Circle> circles,
+	    std::span<const Color> brushColors,
+	    std::span<const Color> lineColors) override;
+
+	[[nodiscard]] TileGrid tileGrid() const override;
+	bool drawTiles(const std::function<void(std::size_t, ICanvas &)>
+	        &drawTile) override;
+
+	void text(const Geom::Rect &rect,
+	    const std::string &text) override;
+
+	void setBrushGradient(const LinearGradient &gradient) override;
+
+	void frameBegin() override;
+	void frameEnd() override {}
+
+private:
+	class Tile;
+	class Workers;
+
+	struct Shadow
+	{
+		Color color;
+		Geom::Point offset;
+		double blur{};
+	};
+
+	struct State
+	{
+		Geom::AffineTransform transform;
+		Color brushColor{0.0, 0.0, 0.0, 1.0};
+		std::optional<LinearGradient> brushGradient;
+		Color lineColor{0.0, 0.0, 0.0, 1.0};
+		double lineWidth{1.0};
+		Font font{10.0};
+		std::shared_ptr<const std::vector<float>> clip;
+		std::optional<Shadow> shadow;
+	};
+
+	struct Path
+	{
+		std::vector<Geom::Point> points;
+		std::vector<std::size_t> ends;
+
+		void clear();
+		void close(bool orient = false);
+	};
+
+	struct Paint
+	{
+		Color color;
+		const LinearGradient *gradient{};
+		Geom::AffineTransform inverse;
+
+		[[nodiscard]] Color at(const Geom::Point &pixel) const;
+	};
+
+	struct Coverage
+	{
+		std::size_t x0{};
+		std::size_t y0{};
+		std::size_t width{};
+		std::size_t height{};
+		std::vector<double> values;
+	};
+
+	std::size_t width;
+	std::size_t height;
+	std::vector<std::uint8_t> pixels;
+	std::vector<State> states;
+	Path polygon;
+	Path shape;
+	Path outline;
+	Coverage coverage;
+	std::vector<float> accumulation;
+	std::vector<double> blurred;
+	std::size_t tileSize{};
+	std::size_t threads{};
+	std::vector<std::unique_ptr<Tile>> tiles;
+	std::unique_ptr<Workers> workers;
+
+	[[nodiscard]] State &state() { return states.back(); }
+	[[nodiscard]] const State &state() const { return states.back(); }
+	[[nodiscard]] Geom::Point device(const Geom::Point &point) const;
+	[[nodiscard]] double deviceScale() const;
+	[[nodiscard]] Paint brush() const;
+
+	void rectPath(Path &path, const Geom::Rect &rect) const;
+	void bezierPath(Path &path,
+	    const Geom::Point &control0,
+	    const Geom::Point &control1,
+	    const Geom::Point &endPoint) const;
+	void circlePath(Path &path, const Geom::Circle &circle) const;
+	void strokeOutline(const Path &path, bool closed);
+
+	void fillPath(const Path &path);
+	void strokePath(const Path &path, bool closed);
+	void clipPath(const Path &path);
+	void draw(const Path &path, const Paint &paint);
+
+	bool rasterize(const Path &path,
+	    const Geom::Point &offset = {},
+	    std::size_t blur = 0);
+	void addEdge(Geom::Point p0, Geom::Point p1);
+	void accumulate(const Geom::Point &p0, const Geom::Point &p1);
+	void blur(std::size_t radius);
+	void composite(const Paint &paint);
+	void renderTile(std::size_t index,
+	    const TileGrid &grid,
+	    const std::function<void(std::size_t, ICanvas &)> &drawTile);
+};
+
+}
+
+#endif
@@ -0,0 +1,389 @@
+#include "recordingcanvas.h"
+
+#include <cstddef>
+#include <iterator>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string>
+
+#include "base/geom/affinetransform.h"
+#include "base/geom/circle.h"
+#include "base/geom/line.h"
+#include "base/geom/point.h"
+#include "base/geom/rect.h"
+
+#include "color.h"
+#include "font.h"
+#include "lineargradient.h"
+
+namespace Gfx
+{
+
+void RecordingCanvas::setClipRect(const Geom::Rect &rect)
+{
+	if (!clipRect || *clipRect != rect) {
+		clipRect = rect;
+		add(Command::setClipRect,
+		    {rect.pos.x, rect.pos.y, rect.size.x, rect.size.y});
+	}
+}
+
+void RecordingCanvas::setClipCircle(const Geom::Circle &circle)
+{
+	clipRect = circle.boundary();
+	add(Command::setClipCircle,
+	    {circle.center.x, circle.center.y, circle.radius});
+}
+
+void RecordingCanvas::setClipPolygon() { add(Command::setClipPolygon); }
+
+void RecordingCanvas::setBrushColor(const Color &color)
+{
+	if (color != brushColor) {
+		brushColor = color;
+		addColor(Command::setBrushColor, color);
+	}
+}
+
+void RecordingCanvas::setLineColor(const Color &color)
+{
+	if (color != lineColor) {
+		lineColor = color;
+		addColor(Command::setLineColor, color);
+	}
+}
+
+void RecordingCanvas::setLineWidth(double width)
+{
+	if (width != lineWidth) {
+		lineWidth = width;
+		add(Command::setLineWidth, {width});
+	}
+}
+
+void RecordingCanvas::setFont(const Font &font)
+{
+	if (this->font != font) {
+		this->font = font;
+		add(Command::setFont, {stringIndex(font.toCSS())});
+	}
+}
+
+void RecordingCanvas::transform(
+    const Geom::AffineTransform &transform)
+{
+	const auto &[r0, r1] = transform.getMatrix();
+	add(Command::transform,
+	    {r0[0], r1[0], r0[1], r1[1], r0[2], r1[2]});
+}
+
+void RecordingCanvas::save() { add(Command::save); }
+
+void RecordingCanvas::restore()
+{
+	add(Command::restore);
+	resetStates();
+}
+
+void RecordingCanvas::beginDropShadow()
+{
+	add(Command::beginDropShadow);
+}
+
+void RecordingCanvas::setDropShadowBlur(double radius)
+{
+	add(Command::setDropShadowBlur, {radius});
+}
+
+void RecordingCanvas::setDropShadowColor(const Color &color)
+{
+	addColor(Command::setDropShadowColor, color);
+}
+
+void RecordingCanvas::setDropShadowOffset(const Geom::Point &offset)
+{
+	add(Command::setDropShadowOffset, {offset.x, offset.y});
+}
+
+void RecordingCanvas::endDropShadow() { add(Command::endDropShadow); }
+
+void RecordingCanvas::beginPolygon() { add(Command::beginPolygon); }
+
+void RecordingCanvas::addPoint(const Geom::Point &point)
+{
+	add(Command::addPoint, {point.x, point.y});
+}
+
+void RecordingCanvas::addBezier(const Geom::Point &control0,
+    const Geom::Point &control1,
+    const Geom::Point &endPoint)
+{
+	add(Command::addBezier,
+	    {control0.x,
+	        control0.y,
+	        control1.x,
+	        control1.y,
+	        endPoint.x,
+	        endPoint.y});
+}
+
+void RecordingCanvas::endPolygon() { add(Command::endPolygon); }
+
+void RecordingCanvas::rectangle(const Geom::Rect &rect)
+{
+	add(Command::rectangle,
+	    {rect.pos.x, rect.pos.y, rect.size.x, rect.size.y});
+}
+
+void RecordingCanvas::circle(const Geom::Circle &circle)
+{
+	add(Command::circle,
+	    {circle.center.x, circle.center.y, circle.radius});
+}
+
+void RecordingCanvas::line(const Geom::Line &line)
+{
+	add(Command::line,
+	    {line.begin.x, line.begin.y, line.end.x, line.end.y});
+}
+
+bool RecordingCanvas::rectangles(std::span<const Geom::Rect> rects,
+    std::span<const Color> brushColors,
+    std::span<const Color> lineColors)
+{
+	if (rects.empty()) return true;
+
+	add(Command::rectangles, {static_cast<double>(rects.size())});
+	for (auto i = 0U; i < rects.size(); ++i) {
+		const auto &rect = rects[i];
+		arguments.insert(arguments.end(),
+		    {rect.pos.x, rect.pos.y, rect.size.x, rect.size.y});
+		addColors(brushColors[i], lineColors[i]);
+	}
+	return true;
+}
+
+bool RecordingCanvas::circles(std::span<const Geom::Circle> circles,
+    std::span<const Color> brushColors,
+    std::span<const Color> lineColors)
+{
+	if (circles.empty()) return true;
+
+	add(Command::circles, {static_cast<double>(circles.size())});
+	for (auto i = 0U; i < circles.size(); ++i) {
+		const auto &circle = circles[i];
+		arguments.insert(arguments.end(),
+		    {circle.center.x, circle.center.y, circle.radius});
+		addColors(brushColors[i], lineColors[i]);
+	}
+	return true;
+}
+
+void RecordingCanvas::text(const Geom::Rect &rect,
+    const std::string &text)
+{
+	add(Command::text,
+	    {rect.pos.x,
+	        rect.pos.y,
+	        rect.size.x,
+	        rect.size.y,
+	        stringIndex(text)});
+}
+
+void RecordingCanvas::setBrushGradient(const LinearGradient &gradient)
+{
+	const auto &stops = gradient.colors.stops;
+	add(Command::setBrushGradient,
+	    {gradient.line.begin.x,
+	        gradient.line.begin.y,
+	        gradient.line.end.x,
+	        gradient.line.end.y,
+	        static_cast<double>(stops.size())});
+
+	for (const auto &stop : stops)
+		arguments.insert(arguments.end(),
+		    {stop.pos,
+		        stop.value.red,
+		        stop.value.green,
+		        stop.value.blue,
+		        stop.value.alpha});
+}
+
+void RecordingCanvas::frameBegin()
+{
+	commands.clear();
+	arguments.clear();
+	strings.clear();
+	stringIndices.clear();
+	resetStates();
+}
+
+void RecordingCanvas::clearCommands()
+{
+	commands.clear();
+	arguments.clear();
+	strings.clear();
+	stringIndices.clear();
+	// an open layer lost its beginning, it is not cached this time
+	openLayer.reset();
+}
+
+bool RecordingCanvas::replayLayer(std::size_t id, std::size_t key)
+{
+	auto it = layers.find(id);
+	if (it == layers.end() || it->second.key != key) return false;
+
+	const auto &layer = it->second;
+	auto firstArgument = arguments.size();
+	commands.insert(commands.end(),
+	    layer.commands.begin(),
+	    layer.commands.end());
+	arguments.insert(arguments.end(),
+	    layer.arguments.begin(),
+	    layer.arguments.end());
+
+	forEachString(layer.commands.data(),
+	    layer.commands.size(),
+	    arguments.data() + firstArgument,
+	    [this, &layer](double &index)
+	    {
+		    index = stringIndex(
+		        layer.strings[static_cast<std::size_t>(index)]);
+	    });
+
+	resetStates();
+	return true;
+}
+
+void RecordingCanvas::beginLayer(std::size_t id, std::size_t key)
+{
+	openLayer = {id, key, commands.size(), arguments.size()};
+	resetStates();
+}
+
+void RecordingCanvas::endLayer()
+{
+	if (!openLayer) return;
+
+	auto &layer = layers[openLayer->id];
+	layer.key = openLayer->key;
+	layer.commands.assign(
+	    commands.begin()
+	        + static_cast<std::ptrdiff_t>(openLayer->firstCommand),
+	    commands.end());
+	layer.arguments.assign(
+	    arguments.begin()
+	        + static_cast<std::ptrdiff_t>(openLayer->firstArgument),
+	    arguments.end());
+	layer.strings.clear();
+
+	forEachString(layer.commands.data(),
+	    layer.commands.size(),
+	    layer.arguments.data(),
+	    [this, &layer](double &index)
+	    {
+		    layer.strings.push_back(
+		        strings[static_cast<std::size_t>(index)]);
+		    index = static_cast<double>(layer.strings.size() - 1);
+	    });
+
+	openLayer.reset();
+}
+
+template <class Fn>
+void RecordingCanvas::forEachString(const Command *commands,
+    std::size_t count,
+    double *arguments,
+    Fn &&fn)
+{
+	for (const auto *command = commands; command != commands + count;
+	     ++command) {
+		switch (*command) {
+		case Command::setFont: fn(arguments[0]); break;
+		case Command::text: fn(arguments[4]); break;
+		default: break;
+		}
+
+		switch (*command) {
+		case Command::setClipPolygon:
+		case Command::beginDropShadow:
+		case Command::endDropShadow:
+		case Command::beginPolygon:
+		case Command::endPolygon:
+		case Command::save:
+		case Command::restore: break;
+		case Command::setLineWidth:
+		case Command::setFont:
+		case Command::setDropShadowBlur: arguments += 1; break;
+		case Command::setDropShadowOffset:
+		case Command::addPoint: arguments += 2; break;
+		case Command::setClipCircle:
+		case Command::circle: arguments += 3; break;
+		case Command::setClipRect:
+		case Command::setBrushColor:
+		case Command::setLineColor:
+		case Command::setDropShadowColor:
+		case Command::rectangle:
+		case Command::line: arguments += 4; break;
+		case Command::text: arguments += 5; break;
+		case Command::addBezier:
+		case Command::transform: arguments += 6; break;
+		case Command::setBrushGradient:
+			arguments += 5 * (1 + static_cast<std::size_t>(arguments[4]));
+			break;
+		case Command::rectangles:
+			arguments += 1 + 12 * static_cast<std::size_t>(arguments[0]);
+			break;
+		case Command::circles:
+			arguments += 1 + 11 * static_cast<std::size_t>(arguments[0]);
+			break;
+		}
+	}
+}
+
+void RecordingCanvas::add(Command command,
+    std::initializer_list<double> args)
+{
+	commands.push_back(command);
+	arguments.insert(arguments.end(), args);
+}
+
+void RecordingCanvas::addColor(Command command, const Color &color)
+{
+	add(command, {color.red, color.green, color.blue, color.alpha});
+}
+
+void RecordingCanvas::addColors(const Color &brush, const Color &line)
+{
+	brushColor = brush;
+	lineColor = line;
+	arguments.insert(arguments.end(),
+	    {brush.red,
+	        brush.green,
+	        brush.blue,
+	        brush.alpha,
+	        line.red,
+	        line.green,
+	        line.blue,
+	        line.alpha});
+}
+
+double RecordingCanvas::stringIndex(const std::string &str)
+{
+	auto [it, inserted] =
+	    stringIndices.try_emplace(str, strings.size());
+	if (inserted) strings.push_back(str);
+	return static_cast<double>(it->second);
+}
+
+void RecordingCanvas::resetStates()
+{
+	font = std::nullopt;
+	brushColor = std::nullopt;
+	lineColor = std::nullopt;
+	lineWidth = std::nullopt;
+	clipRect = std::nullopt;
+}
+
+}
@@ -0,0 +1,162 @@
+#ifndef GFX_RECORDINGCANVAS_H
+#define GFX_RECORDINGCANVAS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <optional>
+#include <span>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "canvas.h"
+
+namespace Gfx
+{
+
+class RecordingCanvas : public ICanvas
+{
+public:
+	// the order is part of the binary format, replayers depend on it
+	enum class Command : std::uint8_t {
+		setClipRect,
+		setClipCircle,
+		setClipPolygon,
+		setBrushColor,
+		setLineColor,
+		setLineWidth,
+		setFont,
+		beginDropShadow,
+		setDropShadowBlur,
+		setDropShadowColor,
+		setDropShadowOffset,
+		endDropShadow,
+		beginPolygon,
+		addPoint,
+		addBezier,
+		endPolygon,
+		rectangle,
+		circle,
+		line,
+		text,
+		setBrushGradient,
+		transform,
+		save,
+		restore,
+		rectangles,
+		circles
+	};
+
+	void setClipRect(const Geom::Rect &rect) override;
+	void setClipCircle(const Geom::Circle &circle) override;
+	void setClipPolygon() override;
+	void setBrushColor(const Color &color) override;
+	void setLineColor(const Color &color) override;
+	void setLineWidth(double width) override;
+	void setFont(const Font &font) override;
+
+	void transform(const Geom::AffineTransform &transform) override;
+	void save() override;
+	void restore() override;
+	void beginDropShadow() override;
+	void setDropShadowBlur(double radius) override;
+	void setDropShadowColor(const Color &color) override;
+	void setDropShadowOffset(const Geom::Point &offset) override;
+	void endDropShadow() override;
+
+	void beginPolygon() override;
+	void addPoint(const Geom::Point &point) override;
+	void addBezier(const Geom::Point &control0,
+	    const Geom::Point &control1,
+	    const Geom::Point &endPoint) override;
+	void endPolygon() override;
+
+	void rectangle(const Geom::Rect &rect) override;
+	void circle(const Geom::Circle &circle) override;
+	void line(const Geom::Line &line) override;
+
+	bool rectangles(std::span<const Geom::Rect> rects,
+	    std::span<const Color> brushColors,
+	    std::span<const Color> lineColors) override;
+	bool circles(std::span<const Geom::Circle> circles,
+	    std::span<const Color> brushColors,
+	    std::span<const Color> lineColors) override;
+
+	void text(const Geom::Rect &rect,
+	    const std::string &text) override;
+
+	void setBrushGradient(const LinearGradient &gradient) override;
+
+	void frameBegin() override;
+	void frameEnd() override {}
+
+	bool replayLayer(std::size_t id, std::size_t key) override;
+	void beginLayer(std::size_t id, std::size_t key) override;
+	void endLayer() override;
+
+	[[nodiscard]] const std::vector<Command> &getCommands() const
+	{
+		return commands;
+	}
+	[[nodiscard]] const std::vector<double> &getArguments() const
+	{
+		return arguments;
+	}
+	[[nodiscard]] const std::vector<std::string> &getStrings() const
+	{
+		return strings;
+	}
+
+protected:
+	// drops the commands already drawn, the tracked states are kept
+	// as they hold on the drawn surface too
+	void clearCommands();
+
+private:
+	struct Layer
+	{
+		std::size_t key{};
+		std::vector<Command> commands;
+		std::vector<double> arguments;
+		std::vector<std::string> strings;
+	};
+
+	struct OpenLayer
+	{
+		std::size_t id;
+		std::size_t key;
+		std::size_t firstCommand;
+		std::size_t firstArgument;
+	};
+
+	std::vector<Command> commands;
+	std::vector<double> arguments;
+	std::vector<std::string> strings;
+	std::unordered_map<std::string, std::size_t> stringIndices;
+
+	std::optional<Font> font;
+	std::optional<Color> brushColor;
+	std::optional<Color> lineColor;
+	std::optional<double> lineWidth;
+	std::optional<Geom::Rect> clipRect;
+
+	std::unordered_map<std::size_t, Layer> layers;
+	std::optional<OpenLayer> openLayer;
+
+	void add(Command command, std::initializer_list<double> args = {});
+	void addColor(Command command, const Color &color);
+	void addColors(const Color &brush, const Color &line);
+	double stringIndex(const std::string &str);
+	void resetStates();
+
+	template <class Fn>
+	static void forEachString(const Command *commands,
+	    std::size_t count,
+	    double *arguments,
+	    Fn &&fn);
+};
+
+}
+
+#endif
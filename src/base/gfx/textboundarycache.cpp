@@ -0,0 +1,133 @@
+#include "textboundarycache.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include "base/util/hash.h"
+
+namespace Gfx
+{
+
+namespace
+{
+
+std::size_t utf8Length(unsigned char lead)
+{
+	if (lead < 0x80) return 1;
+	if ((lead & 0xE0) == 0xC0) return 2;
+	if ((lead & 0xF0) == 0xE0) return 3;
+	if ((lead & 0xF8) == 0xF0) return 4;
+	return 1;
+}
+
+}
+
+std::size_t TextBoundaryCache::KeyHash::operator()(
+    const KeyView &key) const noexcept
+{
+	return Util::Hash{}
+	    .add(key.text,
+	        key.font.size,
+	        static_cast<int>(key.font.weight),
+	        key.font.style,
+	        key.font.family)
+	    .get();
+}
+
+TextBoundaryCache::TextBoundaryCache(Measure measure,
+    std::size_t capacity) :
+    measure(measure),
+    capacity(std::max<std::size_t>(capacity, 1))
+{}
+
+Geom::Size TextBoundaryCache::get(const Font &font,
+    const std::string &text)
+{
+	const std::lock_guard lock(mutex);
+
+	if (auto it = index.find(KeyView{font, text});
+	    it != index.end()) {
+		++stats.hits;
+		entries.splice(entries.begin(), entries, it->second);
+		return it->second->second;
+	}
+
+	++stats.misses;
+	auto res = measureText(font, text);
+	insert(Key{font, text}, res);
+	return res;
+}
+
+Geom::Size TextBoundaryCache::measureText(const Font &font,
+    const std::string &text)
+{
+	if (!glyphAdvanceMode || text.empty()
+	    || text.find('\n') != std::string::npos)
+		return measure(font, text);
+
+	Geom::Size res{0.0, 0.0};
+	bool allKnown = true;
+	for (std::size_t pos{}; pos < text.size();) {
+		auto lead = static_cast<unsigned char>(text[pos]);
+		auto length = std::min(utf8Length(lead), text.size() - pos);
+		const KeyView glyph{font,
+		    std::string_view{text}.substr(pos, length)};
+		pos += length;
+
+		auto it = glyphs.find(glyph);
+		if (it == glyphs.end()) {
+			allKnown = false;
+			Key key{font, std::string{glyph.text}};
+			auto size = measure(font, key.text);
+			it = glyphs.emplace(std::move(key), size).first;
+		}
+		res.x += it->second.x;
+		res.y = std::max(res.y, it->second.y);
+	}
+
+	if (!allKnown) return measure(font, text);
+
+	++stats.glyphHits;
+	return res;
+}
+
+void TextBoundaryCache::insert(Key &&key, const Geom::Size &size)
+{
+	entries.emplace_front(std::move(key), size);
+	index.emplace(entries.front().first, entries.begin());
+
+	if (entries.size() > capacity) {
+		index.erase(entries.back().first);
+		entries.pop_back();
+	}
+	stats.size = entries.size();
+}
+
+void TextBoundaryCache::clear()
+{
+	const std::lock_guard lock(mutex);
+	entries.clear();
+	index.clear();
+	glyphs.clear();
+	stats = {};
+	++generation;
+}
+
+void TextBoundaryCache::setGlyphAdvanceMode(bool enable)
+{
+	const std::lock_guard lock(mutex);
+	glyphAdvanceMode = enable;
+}
+
+TextBoundaryCache::Stats TextBoundaryCache::getStats() const
+{
+	const std::lock_guard lock(mutex);
+	return stats;
+}
+
+}
@@ -0,0 +1,118 @@
+#ifndef GFX_TEXTBOUNDARYCACHE_H
+#define GFX_TEXTBOUNDARYCACHE_H
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+#include "base/geom/point.h"
+
+#include "font.h"
+
+namespace Gfx
+{
+
+class TextBoundaryCache
+{
+public:
+	using Measure = Geom::Size (*)(const Font &, const std::string &);
+
+	struct Stats
+	{
+		std::size_t hits;
+		std::size_t misses;
+		std::size_t glyphHits;
+		std::size_t size;
+	};
+
+	static constexpr std::size_t defaultCapacity = 4096;
+
+	explicit TextBoundaryCache(Measure measure,
+	    std::size_t capacity = defaultCapacity);
+
+	Geom::Size get(const Font &font, const std::string &text);
+
+	void clear();
+	void setGlyphAdvanceMode(bool enable);
+	[[nodiscard]] Stats getStats() const;
+	[[nodiscard]] std::size_t getGeneration() const
+	{
+		return generation;
+	}
+
+private:
+	struct KeyView
+	{
+		const Font &font;
+		std::string_view text;
+	};
+
+	struct Key
+	{
+		Font font;
+		std::string text;
+
+		[[nodiscard]] KeyView view() const { return {font, text}; }
+	};
+
+	// lookups take a KeyView so that a hit copies neither the font
+	// nor the text
+	struct KeyHash
+	{
+		using is_transparent = void;
+
+		std::size_t operator()(const KeyView &key) const noexcept;
+		std::size_t operator()(const Key &key) const noexcept
+		{
+			return (*this)(key.view());
+		}
+	};
+
+	struct KeyEqual
+	{
+		using is_transparent = void;
+
+		bool operator()(const KeyView &lhs,
+		    const KeyView &rhs) const
+		{
+			return lhs.text == rhs.text && lhs.font == rhs.font;
+		}
+		bool operator()(const Key &lhs, const Key &rhs) const
+		{
+			return (*this)(lhs.view(), rhs.view());
+		}
+		bool operator()(const KeyView &lhs, const Key &rhs) const
+		{
+			return (*this)(lhs, rhs.view());
+		}
+		bool operator()(const Key &lhs, const KeyView &rhs) const
+		{
+			return (*this)(lhs.view(), rhs);
+		}
+	};
+
+	using Entries = std::list<std::pair<Key, Geom::Size>>;
+
+	Measure measure;
+	std::size_t capacity;
+	bool glyphAdvanceMode{};
+	Stats stats{};
+	std::atomic<std::size_t> generation{};
+
+	mutable std::mutex mutex;
+	Entries entries;
+	std::unordered_map<Key, Entries::iterator, KeyHash, KeyEqual>
+	    index;
+	std::unordered_map<Key, Geom::Size, KeyHash, KeyEqual> glyphs;
+
+	Geom::Size measureText(const Font &font, const std::string &text);
+	void insert(Key &&key, const Geom::Size &size);
+};
+
+}
+
+#endif
@@ -0,0 +1,31 @@
+#ifndef STYLE_PARAMCOMPARER
+#define STYLE_PARAMCOMPARER
+
+#include "base/refl/auto_struct.h"
+
+#include "param.h"
+
+namespace Style
+{
+
+struct ParamComparer
+{
+	bool equal{true};
+
+	template <IsParam T> void operator()(const T &lhs, const T &rhs)
+	{
+		if (equal && !(lhs == rhs)) equal = false;
+	}
+
+	template <class T>
+	[[nodiscard]] static bool equals(const T &lhs, const T &rhs)
+	{
+		ParamComparer comparer;
+		Refl::visit(comparer, lhs, rhs);
+		return comparer.equal;
+	}
+};
+
+}
+
+#endif
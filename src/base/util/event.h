@@ -51,6 +51,11 @@ public:
 
 	void detachAll() { handlers.clear(); }
 
+	[[nodiscard]] bool hasListeners() const
+	{
+		return !handlers.empty();
+	}
+
 protected:
 	handler_list handlers;
 };
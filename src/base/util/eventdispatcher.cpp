@@ -32,6 +32,8 @@ EventDispatcher::Params::~Params() = default;
 
 bool EventDispatcher::Event::invoke(Params &&params) const
 {
+	if (!hasListeners()) return true;
+
 	params.eventName = name;
 
 	operator()(params, params.toJSON());
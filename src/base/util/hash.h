@@ -0,0 +1,33 @@
+#ifndef UTIL_HASH_H
+#define UTIL_HASH_H
+
+#include <cstddef>
+#include <functional>
+
+namespace Util
+{
+
+class Hash
+{
+public:
+	template <class... Ts> Hash &add(const Ts &...values)
+	{
+		(combine(std::hash<Ts>{}(values)), ...);
+		return *this;
+	}
+
+	[[nodiscard]] std::size_t get() const { return value; }
+
+private:
+	std::size_t value{};
+
+	void combine(std::size_t hash)
+	{
+		value ^= hash + 0x9e3779b97f4a7c15ULL + (value << 6)
+		       + (value >> 2);
+	}
+};
+
+}
+
+#endif
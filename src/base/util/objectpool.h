@@ -0,0 +1,60 @@
+#ifndef UTIL_OBJECTPOOL_H
+#define UTIL_OBJECTPOOL_H
+
+#include <cstddef>
+#include <memory>
+#include <memory_resource>
+#include <utility>
+
+namespace Util
+{
+
+class ObjectPool
+{
+public:
+	struct Deleter
+	{
+		std::pmr::memory_resource *resource{};
+		void *block{};
+		std::size_t size{};
+		std::size_t alignment{};
+
+		template <class T> void operator()(T *object) const
+		{
+			std::destroy_at(object);
+			resource->deallocate(block, size, alignment);
+		}
+	};
+
+	template <class T> using Ptr = std::unique_ptr<T, Deleter>;
+
+	explicit ObjectPool(std::pmr::memory_resource *upstream =
+	                        std::pmr::get_default_resource()) :
+	    pool(upstream)
+	{}
+
+	template <class T, class... Args> Ptr<T> make(Args &&...args)
+	{
+		void *block = pool.allocate(sizeof(T), alignof(T));
+		try {
+			return {new (block) T(std::forward<Args>(args)...),
+			    {&pool, block, sizeof(T), alignof(T)}};
+		}
+		catch (...) {
+			pool.deallocate(block, sizeof(T), alignof(T));
+			throw;
+		}
+	}
+
+	[[nodiscard]] std::pmr::memory_resource *resource()
+	{
+		return &pool;
+	}
+
+private:
+	std::pmr::unsynchronized_pool_resource pool;
+};
+
+}
+
+#endif
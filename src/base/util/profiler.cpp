@@ -0,0 +1,190 @@
+#include "profiler.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include "base/conv/auto_json.h"
+
+namespace Util
+{
+
+namespace
+{
+
+struct Stats
+{
+	std::size_t count;
+	double p50;
+	double p95;
+	double max;
+};
+
+using Samples = std::map<std::string_view, std::vector<double>>;
+
+template <class SeriesMap>
+void collect(Samples &samples, const SeriesMap &map)
+{
+	for (const auto &[name, series] : map) {
+		auto &values = samples[name];
+		values.insert(values.end(),
+		    series.values.begin(),
+		    series.values.begin()
+		        + static_cast<std::ptrdiff_t>(series.size));
+	}
+}
+
+Stats statsOf(std::vector<double> &values)
+{
+	std::ranges::sort(values);
+
+	auto percentile = [&values](double p)
+	{
+		auto rank = static_cast<std::size_t>(
+		    std::ceil(p * static_cast<double>(values.size())));
+		return values[std::max<std::size_t>(rank, 1) - 1];
+	};
+
+	return {values.size(),
+	    percentile(0.5),
+	    percentile(0.95),
+	    values.back()};
+}
+
+std::map<std::string_view, Stats> statsOf(Samples &samples)
+{
+	std::map<std::string_view, Stats> res;
+	for (auto &[name, values] : samples)
+		res.emplace(name, statsOf(values));
+	return res;
+}
+
+template <class SeriesMap>
+void merge(SeriesMap &target, const SeriesMap &source)
+{
+	for (const auto &[name, series] : source)
+		target[name].addAll(series);
+}
+
+}
+
+class Profiler::ThreadBuffer : public Buffer
+{
+public:
+	ThreadBuffer()
+	{
+		auto &profiler = getInstance();
+		const std::lock_guard lock{profiler.mutex};
+		profiler.buffers.push_back(this);
+	}
+	ThreadBuffer(const ThreadBuffer &) = delete;
+	ThreadBuffer &operator=(const ThreadBuffer &) = delete;
+	~ThreadBuffer()
+	{
+		auto &profiler = getInstance();
+		const std::lock_guard lock{profiler.mutex};
+		std::erase(profiler.buffers, this);
+		merge(profiler.retired.stages, stages);
+		merge(profiler.retired.counters, counters);
+	}
+};
+
+void Profiler::Series::add(double value)
+{
+	values[next] = value;
+	next = (next + 1) % capacity;
+	size = std::min(size + 1, capacity);
+}
+
+void Profiler::Series::addAll(const Series &other)
+{
+	for (std::size_t ix{}; ix < other.size; ++ix)
+		add(other.values[(other.next + capacity - other.size + ix)
+		                 % capacity]);
+}
+
+Profiler &Profiler::getInstance()
+{
+	static Profiler profiler{};
+	return profiler;
+}
+
+Profiler::Buffer &Profiler::localBuffer()
+{
+	thread_local ThreadBuffer buffer;
+	return buffer;
+}
+
+void Profiler::setEnabled(bool value)
+{
+	if (value && !isEnabled()) reset();
+	enabled.store(value, std::memory_order_relaxed);
+}
+
+void Profiler::record(std::string_view stage,
+    Clock::duration elapsed)
+{
+	add(&Buffer::stages,
+	    stage,
+	    std::chrono::duration<double, std::milli>{elapsed}.count());
+}
+
+void Profiler::count(std::string_view counter, double value)
+{
+	if (isEnabled()) add(&Buffer::counters, counter, value);
+}
+
+void Profiler::add(SeriesMap Buffer::*map,
+    std::string_view name,
+    double value)
+{
+	auto &buffer = localBuffer();
+	const std::lock_guard lock{buffer.mutex};
+	auto &series = buffer.*map;
+	auto it = series.find(name);
+	if (it == series.end())
+		it = series.try_emplace(std::string{name}).first;
+	it->second.add(value);
+}
+
+void Profiler::reset()
+{
+	auto &profiler = getInstance();
+	const std::lock_guard lock{profiler.mutex};
+	profiler.retired.stages.clear();
+	profiler.retired.counters.clear();
+	for (auto *buffer : profiler.buffers) {
+		const std::lock_guard bufferLock{buffer->mutex};
+		buffer->stages.clear();
+		buffer->counters.clear();
+	}
+}
+
+std::string Profiler::toJSON()
+{
+	auto &profiler = getInstance();
+	const std::lock_guard lock{profiler.mutex};
+
+	Samples stages;
+	Samples counters;
+	collect(stages, profiler.retired.stages);
+	collect(counters, profiler.retired.counters);
+	for (auto *buffer : profiler.buffers) {
+		const std::lock_guard bufferLock{buffer->mutex};
+		collect(stages, buffer->stages);
+		collect(counters, buffer->counters);
+	}
+
+	std::string res;
+	Conv::JSONObj{res}("enabled", isEnabled())("stages",
+	    statsOf(stages))("counters", statsOf(counters));
+	return res;
+}
+
+}
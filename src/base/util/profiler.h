@@ -0,0 +1,100 @@
+#ifndef UTIL_PROFILER_H
+#define UTIL_PROFILER_H
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Util
+{
+
+class Profiler
+{
+public:
+	using Clock = std::chrono::steady_clock;
+
+	static constexpr std::size_t capacity = 1024;
+
+	class Scope
+	{
+	public:
+		explicit Scope(std::string_view stage) :
+		    stage(isEnabled() ? stage : std::string_view{}),
+		    begin(this->stage.empty() ? Clock::time_point{}
+		                              : Clock::now())
+		{}
+		Scope(const Scope &) = delete;
+		Scope &operator=(const Scope &) = delete;
+		~Scope()
+		{
+			if (!stage.empty()) record(stage, Clock::now() - begin);
+		}
+
+	private:
+		std::string_view stage;
+		Clock::time_point begin;
+	};
+
+	static void setEnabled(bool);
+	[[nodiscard]] static bool isEnabled()
+	{
+		return enabled.load(std::memory_order_relaxed);
+	}
+
+	static void record(std::string_view stage,
+	    Clock::duration elapsed);
+	static void count(std::string_view counter, double value);
+	static void reset();
+	static std::string toJSON();
+
+private:
+	struct Series
+	{
+		std::array<double, capacity> values{};
+		std::size_t next{};
+		std::size_t size{};
+
+		void add(double value);
+		void addAll(const Series &other);
+	};
+
+	using SeriesMap = std::map<std::string, Series, std::less<>>;
+
+	// samples of one thread, its mutex is contended only by the
+	// readers merging the buffers
+	struct Buffer
+	{
+		std::mutex mutex;
+		SeriesMap stages;
+		SeriesMap counters;
+	};
+
+	class ThreadBuffer;
+
+	static inline std::atomic<bool> enabled{};
+
+	// guards the registered buffers and the samples of exited threads
+	std::mutex mutex;
+	std::vector<Buffer *> buffers;
+	Buffer retired;
+
+	static Profiler &getInstance();
+	static Buffer &localBuffer();
+	Profiler() = default;
+	~Profiler() = default;
+
+	static void add(SeriesMap Buffer::*map,
+	    std::string_view name,
+	    double value);
+};
+
+}
+
+#endif
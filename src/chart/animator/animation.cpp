@@ -55,6 +55,31 @@ void Animation::addKeyframe(const Gen::PlotPtr &next,
 		throw std::logic_error("animation already in progress");
 
 	if (!next) return;
+
+	addKeyframes(prepareKeyframes(target, next, dataTable, options),
+	    next);
+}
+
+void Animation::addKeyframes(Keyframes &&keyframes,
+    const Gen::PlotPtr &next)
+{
+	if (isRunning())
+		throw std::logic_error("animation already in progress");
+
+	for (auto &keyframe : keyframes)
+		Sequence::addKeyframe(std::move(keyframe));
+
+	target = next;
+}
+
+Animation::Keyframes Animation::prepareKeyframes(
+    const Gen::PlotPtr &target,
+    const Gen::PlotPtr &next,
+    const Data::DataTable &dataTable,
+    const Options::Keyframe &options)
+{
+	Keyframes res;
+
 	next->detachOptions();
 
 	auto strategy = options.getRegroupStrategy();
@@ -126,13 +151,13 @@ void Animation::addKeyframe(const Gen::PlotPtr &next,
 	                           && strategy != RegroupStrategy::fade
 	                           && target->getOptions()->looksTheSame(
 	                               *intermediate0->getOptions());
-	auto begin = std::ref(intermediate0 ? intermediate0 : target);
+	auto begin = std::cref(intermediate0 ? intermediate0 : target);
 
 	auto &&intermediate1Instant =
 	    intermediate1 && strategy != RegroupStrategy::fade
 	    && begin.get()->getOptions()->looksTheSame(
 	        *intermediate1->getOptions());
-	begin = intermediate1 ? std::ref(intermediate1) : begin;
+	begin = intermediate1 ? std::cref(intermediate1) : begin;
 
 	auto &&nextInstant = strategy != RegroupStrategy::fade
 	                  && begin.get()->getOptions()->looksTheSame(
@@ -153,30 +178,34 @@ void Animation::addKeyframe(const Gen::PlotPtr &next,
 	begin = target;
 
 	if (intermediate0) {
-		addKeyframe(begin,
+		res.push_back(createKeyframe(begin,
 		    intermediate0,
 		    dataTable,
 		    real_options,
-		    intermediate0Instant);
+		    intermediate0Instant));
 		begin = intermediate0;
 
 		if (!intermediate0Instant)
 			real_options.all.delay = ::Anim::Duration(0);
 	}
 	if (intermediate1) {
-		addKeyframe(begin,
+		res.push_back(createKeyframe(begin,
 		    intermediate1,
 		    dataTable,
 		    real_options,
-		    intermediate1Instant);
+		    intermediate1Instant));
 		begin = intermediate1;
 
 		if (!intermediate1Instant)
 			real_options.all.delay = ::Anim::Duration(0);
 	}
-	addKeyframe(begin, next, dataTable, real_options, nextInstant);
+	res.push_back(createKeyframe(begin,
+	    next,
+	    dataTable,
+	    real_options,
+	    nextInstant));
 
-	target = next;
+	return res;
 }
 
 template <class Modifier>
@@ -215,17 +244,18 @@ Gen::PlotPtr Animation::getIntermediate(const Gen::PlotPtr &base,
 	return res;
 }
 
-void Animation::addKeyframe(const Gen::PlotPtr &source,
+::Anim::ControllablePtr Animation::createKeyframe(
+    const Gen::PlotPtr &source,
     const Gen::PlotPtr &target,
     const Data::DataTable &dataTable,
     const Options::Keyframe &options,
     bool isInstant)
 {
-	Sequence::addKeyframe(std::make_shared<Keyframe>(source,
+	return std::make_shared<Keyframe>(source,
 	    target,
 	    dataTable,
 	    &options,
-	    isInstant));
+	    isInstant);
 }
 
 void Animation::animate(const Option &options,
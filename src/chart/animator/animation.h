@@ -1,6 +1,8 @@
 #ifndef ANIMATION_H
 #define ANIMATION_H
 
+#include <vector>
+
 #include "base/anim/control.h"
 #include "base/anim/sequence.h"
 #include "chart/generator/plotptr.h"
@@ -15,6 +17,7 @@ class Animation : public ::Anim::Sequence, public ::Anim::Control
 {
 public:
 	using OnComplete = Util::Event<const Gen::PlotPtr, const bool>;
+	using Keyframes = std::vector<::Anim::ControllablePtr>;
 
 	Util::Event<const Gen::PlotPtr> onPlotChanged;
 
@@ -24,6 +27,19 @@ public:
 	    const Data::DataTable &dataTable,
 	    const Options::Keyframe &options);
 
+	void addKeyframes(Keyframes &&keyframes, const Gen::PlotPtr &next);
+
+	// mutates the passed plots, they must not be shared
+	static Keyframes prepareKeyframes(const Gen::PlotPtr &target,
+	    const Gen::PlotPtr &next,
+	    const Data::DataTable &dataTable,
+	    const Options::Keyframe &options);
+
+	[[nodiscard]] const Gen::PlotPtr &getTarget() const
+	{
+		return target;
+	}
+
 	void animate(const ::Anim::Control::Option &options,
 	    OnComplete &&onThisCompletes);
 
@@ -38,7 +54,8 @@ private:
 	    const Data::DataTable &dataTable,
 	    Modifier &&modifier);
 
-	void addKeyframe(const Gen::PlotPtr &source,
+	static ::Anim::ControllablePtr createKeyframe(
+	    const Gen::PlotPtr &source,
 	    const Gen::PlotPtr &target,
 	    const Data::DataTable &dataTable,
 	    const Options::Keyframe &options,
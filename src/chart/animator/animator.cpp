@@ -2,14 +2,17 @@
 
 #include <memory>
 #include <stdexcept>
+#include <stop_token>
 #include <utility>
 
 #include "base/anim/control.h"
 #include "base/util/eventdispatcher.h"
+#include "chart/generator/plot.h"
 #include "chart/generator/plotptr.h"
 #include "dataframe/old/types.h"
 
 #include "animation.h"
+#include "keyframeworker.h"
 #include "options.h"
 
 namespace Vizzu::Anim
@@ -26,25 +29,91 @@ Animator::Animator(const Data::DataTable &dataTable,
 {}
 
 void Animator::addKeyframe(const Gen::PlotPtr &plot,
-    const Options::Keyframe &options) const
+    const Options::Keyframe &options)
 {
+	if (auto prepared = worker.wait()) deliver(std::move(*prepared));
+
 	if (running)
 		throw std::logic_error("animation already in progress");
 
 	nextAnimation->addKeyframe(plot, dataTable, options);
 }
 
+void Animator::addKeyframeAsync(PlotFactory &&buildPlot,
+    const Options::Keyframe &options)
+{
+	if (running)
+		throw std::logic_error("animation already in progress");
+
+	auto source = nextAnimation->getTarget();
+	if (source) {
+		source = std::make_shared<Gen::Plot>(*source);
+		source->getStyle().setup();
+		source->detachOptions();
+	}
+
+	worker.submit(
+	    [source = std::move(source),
+	        table = std::make_shared<const Data::DataTable>(
+	            dataTable.snapshot()),
+	        buildPlot = std::move(buildPlot),
+	        options](const std::stop_token &stop)
+	        -> KeyframeWorker::Result
+	    {
+		    auto next = buildPlot(*table);
+		    if (!next || stop.stop_requested()) return {};
+
+		    return {next,
+		        Animation::prepareKeyframes(source,
+		            next,
+		            *table,
+		            options)};
+	    });
+}
+
+bool Animator::update()
+{
+	auto prepared = worker.takeReady();
+	if (prepared) deliver(std::move(*prepared));
+	return prepared.has_value();
+}
+
+void Animator::deliver(KeyframeWorker::Result &&prepared)
+{
+	if (prepared.target) {
+		nextAnimation->addKeyframes(std::move(prepared.keyframes),
+		    prepared.target);
+		onKeyframeReady(prepared.target);
+	}
+	startDeferred();
+}
+
+void Animator::startDeferred()
+{
+	if (!deferredAnimate) return;
+	auto deferred = std::move(*deferredAnimate);
+	deferredAnimate.reset();
+	animate(deferred.options, std::move(deferred.onComplete));
+}
+
 void Animator::setAnimation(const Anim::AnimationPtr &animation)
 {
+	worker.cancel();
 	nextAnimation = animation;
+	startDeferred();
 }
 
 void Animator::animate(const ::Anim::Control::Option &options,
     Animation::OnComplete &&onThisCompletes)
 {
-	if (running)
+	if (running || deferredAnimate)
 		throw std::logic_error("animation already in progress");
 
+	if (worker.isPending()) {
+		deferredAnimate.emplace(options, std::move(onThisCompletes));
+		return;
+	}
+
 	onThisCompletes.attach(
 	    [this](const Gen::PlotPtr &plot, const bool &)
 	    {
@@ -3,10 +3,12 @@
 
 #include <functional>
 #include <memory>
+#include <optional>
 
 #include "base/util/eventdispatcher.h"
 
 #include "animation.h"
+#include "keyframeworker.h"
 #include "options.h"
 
 namespace Vizzu::Anim
@@ -19,8 +21,22 @@ public:
 	    const Util::EventDispatcher::Event &onBegin,
 	    const Util::EventDispatcher::Event &onComplete);
 
+	// runs on the worker thread, on a snapshot of the data table
+	using PlotFactory =
+	    std::function<Gen::PlotPtr(const Data::DataTable &)>;
+
 	void addKeyframe(const Gen::PlotPtr &plot,
-	    const Options::Keyframe &options) const;
+	    const Options::Keyframe &options);
+
+	void addKeyframeAsync(PlotFactory &&buildPlot,
+	    const Options::Keyframe &options);
+
+	bool update();
+
+	[[nodiscard]] bool isPreparing() const
+	{
+		return worker.isPending();
+	}
 
 	void setAnimation(const AnimationPtr &animation);
 
@@ -30,6 +46,7 @@ public:
 	const Data::DataTable &dataTable;
 	Util::Event<const Gen::PlotPtr> onDraw;
 	Util::Event<> onProgress;
+	Util::Event<const Gen::PlotPtr> onKeyframeReady;
 	std::reference_wrapper<const Util::EventDispatcher::Event>
 	    onBegin;
 	std::reference_wrapper<const Util::EventDispatcher::Event>
@@ -39,11 +56,21 @@ public:
 	AnimationPtr getActAnimation() { return actAnimation; }
 
 private:
+	struct DeferredAnimate
+	{
+		::Anim::Control::Option options;
+		Animation::OnComplete onComplete;
+	};
+
 	bool running{};
 	AnimationPtr actAnimation;
 	AnimationPtr nextAnimation;
+	std::optional<DeferredAnimate> deferredAnimate;
+	KeyframeWorker worker;
 	void stripActAnimation() const;
 	void setupActAnimation() const;
+	void deliver(KeyframeWorker::Result &&prepared);
+	void startDeferred();
 };
 
 }
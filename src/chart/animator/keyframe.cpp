@@ -60,49 +60,46 @@ void Keyframe::init(const Gen::PlotPtr &plot,
 void Keyframe::prepareActual()
 {
 	if (Gen::Plot::dimensionMatch(*source, *target)) {
-		if (Gen::Plot::hasMarkerChange(*source, *target))
+		if (Gen::Plot::hasMarkerChange(*source, *target)
+		    || !source->getMarkersInfo().empty())
 			copySourceTarget();
 		Gen::Plot::mergeMarkersAndCellInfo(*source, *target);
 	}
 	else {
+		auto origTarget = target;
 		copySourceTarget();
 		target->prependMarkers(*source);
-		source->appendMarkers(*targetCopy);
+		source->appendMarkers(*origTarget);
 	}
 	prepareActualMarkersInfo();
 
 	actual = std::make_shared<Gen::Plot>(*source);
 	actual->getStyle().setup();
 	actual->detachOptions();
+	actual->detachMarkers();
 }
 
 void Keyframe::prepareActualMarkersInfo()
 {
-	const auto &origTMI = target->getMarkersInfo();
 	auto &smi = source->getMarkersInfo();
-	if (!smi.empty()) copySourceTarget();
+	auto &tmi = target->getMarkersInfo();
 
-	for (auto &tmi = target->getMarkersInfo(); auto &&item : smi)
+	for (auto &&item : smi)
 		tmi.insert(std::pair{item.first, Gen::Plot::MarkerInfo{}});
 
-	for (auto &&item : origTMI)
+	for (auto &&item : tmi)
 		smi.insert(std::pair{item.first, Gen::Plot::MarkerInfo{}});
 }
 
 void Keyframe::copySourceTarget()
 {
-	if (!targetCopy) {
-		targetCopy = target;
-		target = std::make_shared<Gen::Plot>(*targetCopy);
-		target->getStyle().setup();
-		target->detachOptions();
-	}
-	if (!sourceCopy) {
-		sourceCopy = source;
-		source = std::make_shared<Gen::Plot>(*sourceCopy);
-		source->getStyle().setup();
-		source->detachOptions();
-	}
+	target = std::make_shared<Gen::Plot>(*target);
+	target->getStyle().setup();
+	target->detachOptions();
+
+	source = std::make_shared<Gen::Plot>(*source);
+	source->getStyle().setup();
+	source->detachOptions();
 }
 
-}
\ No newline at end of file
+}
@@ -28,8 +28,6 @@ private:
 	Gen::PlotPtr source;
 	Gen::PlotPtr target;
 	Gen::PlotPtr actual;
-	Gen::PlotPtr sourceCopy;
-	Gen::PlotPtr targetCopy;
 
 	void init(const Gen::PlotPtr &plot,
 	    const Data::DataTable &dataTable);
@@ -0,0 +1,74 @@
+#include "keyframeworker.h"
+
+#include <chrono>
+#include <future>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace Vizzu::Anim
+{
+
+KeyframeWorker::~KeyframeWorker() { cancel(); }
+
+void KeyframeWorker::submit(Job &&job)
+{
+	cancel();
+
+	std::packaged_task<Result(const std::stop_token &)> task{
+	    std::move(job)};
+
+	actual.emplace(Task{task.get_future(), {}});
+
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+	task(std::stop_token{});
+#else
+	actual->thread = std::jthread{std::move(task)};
+#endif
+}
+
+void KeyframeWorker::cancel()
+{
+	if (actual) {
+		actual->thread.request_stop();
+		cancelled.push_back(std::move(*actual));
+		actual.reset();
+	}
+	releaseCancelled();
+}
+
+bool KeyframeWorker::isReady() const
+{
+	return actual
+	    && actual->result.wait_for(std::chrono::seconds{0})
+	           == std::future_status::ready;
+}
+
+std::optional<KeyframeWorker::Result> KeyframeWorker::takeReady()
+{
+	if (!isReady()) return std::nullopt;
+	return wait();
+}
+
+std::optional<KeyframeWorker::Result> KeyframeWorker::wait()
+{
+	if (!actual) return std::nullopt;
+	auto task = std::move(*actual);
+	actual.reset();
+	releaseCancelled();
+	return task.result.get();
+}
+
+void KeyframeWorker::releaseCancelled()
+{
+	std::erase_if(cancelled,
+	    [](const Task &task)
+	    {
+		    return task.result.wait_for(std::chrono::seconds{0})
+		        == std::future_status::ready;
+	    });
+}
+
+}
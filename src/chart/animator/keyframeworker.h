@@ -0,0 +1,58 @@
+#ifndef KEYFRAMEWORKER_H
+#define KEYFRAMEWORKER_H
+
+#include <functional>
+#include <future>
+#include <optional>
+#include <stop_token>
+#include <thread>
+#include <vector>
+
+#include "chart/generator/plotptr.h"
+
+#include "animation.h"
+
+namespace Vizzu::Anim
+{
+
+class KeyframeWorker
+{
+public:
+	struct Result
+	{
+		Gen::PlotPtr target;
+		Animation::Keyframes keyframes;
+	};
+
+	using Job = std::function<Result(const std::stop_token &)>;
+
+	KeyframeWorker() = default;
+	KeyframeWorker(const KeyframeWorker &) = delete;
+	KeyframeWorker &operator=(const KeyframeWorker &) = delete;
+	~KeyframeWorker();
+
+	void submit(Job &&job);
+	void cancel();
+
+	[[nodiscard]] bool isPending() const { return actual.has_value(); }
+	[[nodiscard]] bool isReady() const;
+
+	std::optional<Result> takeReady();
+	std::optional<Result> wait();
+
+private:
+	struct Task
+	{
+		std::future<Result> result;
+		std::jthread thread;
+	};
+
+	std::optional<Task> actual;
+	std::vector<Task> cancelled;
+
+	void releaseCancelled();
+};
+
+}
+
+#endif
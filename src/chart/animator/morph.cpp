@@ -5,6 +5,8 @@
 
 #include "base/anim/interpolated.h"
 #include "base/math/interpolation.h"
+#include "base/refl/auto_enum.h"
+#include "base/util/profiler.h"
 #include "chart/generator/axis.h"
 #include "chart/generator/guides.h"
 #include "chart/generator/plot.h"
@@ -32,31 +34,44 @@ std::unique_ptr<AbstractMorph> AbstractMorph::create(
     const Gen::Plot &target,
     Gen::Plot &actual)
 {
+	std::unique_ptr<AbstractMorph> res;
 	switch (sectionId) {
 	case SectionId::color:
-		return std::make_unique<Color>(source, target, actual);
+		res = std::make_unique<Color>(source, target, actual);
+		break;
 	case SectionId::show:
-		return std::make_unique<Show>(source, target, actual);
+		res = std::make_unique<Show>(source, target, actual);
+		break;
 	case SectionId::hide:
-		return std::make_unique<Hide>(source, target, actual);
+		res = std::make_unique<Hide>(source, target, actual);
+		break;
 	case SectionId::x:
-		return std::make_unique<Horizontal>(source, target, actual);
+		res = std::make_unique<Horizontal>(source, target, actual);
+		break;
 	case SectionId::y:
-		return std::make_unique<Vertical>(source, target, actual);
+		res = std::make_unique<Vertical>(source, target, actual);
+		break;
 	case SectionId::geometry:
-		return std::make_unique<Shape>(source, target, actual);
+		res = std::make_unique<Shape>(source, target, actual);
+		break;
 	case SectionId::coordSystem:
-		return std::make_unique<CoordinateSystem>(source,
-		    target,
-		    actual);
+		res =
+		    std::make_unique<CoordinateSystem>(source, target, actual);
+		break;
 	case SectionId::connection:
-		return std::make_unique<Connection>(source, target, actual);
+		res = std::make_unique<Connection>(source, target, actual);
+		break;
 	default: throw std::logic_error("invalid animation section");
 	}
+	res->profilerStage = "Morph::";
+	res->profilerStage += Refl::enum_name(sectionId);
+	return res;
 }
 
 void AbstractMorph::transform(double factor)
 {
+	const Util::Profiler::Scope profile{profilerStage};
+
 	transform(source, target, actual, factor);
 
 	transform(*source.getOptions(),
@@ -64,12 +79,11 @@ void AbstractMorph::transform(double factor)
 	    *actual.getOptions(),
 	    factor);
 
-	for (auto i = 0U; i < source.getMarkers().size(); ++i) {
-		transform(source.getMarkers()[i],
-		    target.getMarkers()[i],
-		    actual.getMarkers()[i],
-		    factor);
-	}
+	const auto &smarkers = source.getMarkers();
+	const auto &tmarkers = target.getMarkers();
+	auto &amarkers = actual.mutableMarkers();
+	for (auto i = 0U; i < smarkers.size(); ++i)
+		transform(smarkers[i], tmarkers[i], amarkers[i], factor);
 }
 
 void CoordinateSystem::transform(const Gen::Options &source,
@@ -2,6 +2,7 @@
 #define MORPH_H
 
 #include <memory>
+#include <string>
 
 #include "base/anim/element.h"
 
@@ -47,6 +48,9 @@ protected:
 	const Dia &source;
 	const Dia &target;
 	Dia &actual;
+
+private:
+	std::string profilerStage;
 };
 
 class CoordinateSystem : public AbstractMorph
@@ -1,8 +1,9 @@
 #include "plot.h"
 
+#include <algorithm>
 #include <compare>
 #include <cstddef>
-#include <map>
+#include <functional>
 #include <memory>
 #include <stdexcept>
 #include <utility>
@@ -62,6 +63,19 @@ Plot::Plot(PlotOptionsPtr opts, Styles::Chart style) :
 	this->style.setup();
 }
 
+Plot::Markers &Plot::mutableMarkers()
+{
+	if (markers.use_count() != 1)
+		throw std::logic_error(
+		    "internal error: plot markers are shared");
+	return *markers;
+}
+
+void Plot::detachMarkers()
+{
+	markers = std::make_shared<Markers>(*markers);
+}
+
 void Plot::detachOptions()
 {
 	options = std::make_shared<Gen::Options>(*options);
@@ -74,6 +88,7 @@ bool Plot::isEmpty() const
 
 Math::Range<> Plot::getMarkersBounds(AxisId axisId) const
 {
+	const auto &markers = getMarkers();
 	auto markerIt = markers.begin();
 	while (markerIt != markers.end()
 	       && !static_cast<bool>(markerIt->enabled))
@@ -90,22 +105,22 @@ Math::Range<> Plot::getMarkersBounds(AxisId axisId) const
 
 void Plot::prependMarkers(const Plot &plot)
 {
-	auto it = markers.insert(markers.begin(),
-	              plot.getMarkers().begin(),
-	              plot.getMarkers().end())
-	        + static_cast<std::ptrdiff_t>(plot.markers.size());
-
-	for (auto i = markers.begin(); i < it; ++i) i->enabled = false;
+	Markers res;
+	res.reserve(plot.markers->size() + markers->size());
+	for (const auto &marker : *plot.markers)
+		res.emplace_back(marker).enabled = false;
+	res.insert(res.end(), markers->begin(), markers->end());
+	markers = std::make_shared<Markers>(std::move(res));
 }
 
 void Plot::appendMarkers(const Plot &plot)
 {
-	for (auto it = markers.insert(markers.end(),
-	         plot.getMarkers().begin(),
-	         plot.getMarkers().end());
-	     it != markers.end();
-	     ++it)
-		it->enabled = false;
+	Markers res;
+	res.reserve(markers->size() + plot.markers->size());
+	res.insert(res.end(), markers->begin(), markers->end());
+	for (const auto &marker : *plot.markers)
+		res.emplace_back(marker).enabled = false;
+	markers = std::make_shared<Markers>(std::move(res));
 }
 
 bool Plot::dimensionMatch(const Plot &a, const Plot &b)
@@ -115,73 +130,109 @@ bool Plot::dimensionMatch(const Plot &a, const Plot &b)
 }
 bool Plot::hasMarkerChange(const Plot &source, const Plot &target)
 {
-	auto msize = source.markers.size();
-	if (msize != target.markers.size()
+	const auto &smarkers = *source.markers;
+	const auto &tmarkers = *target.markers;
+	auto msize = smarkers.size();
+	if (msize != tmarkers.size()
 	    || source.markersInfo != target.markersInfo)
 		return true;
 
 	for (std::size_t ix = 0; ix < msize; ++ix)
-		if (source.markers[ix].idx != target.markers[ix].idx)
-			return true;
+		if (smarkers[ix].idx != tmarkers[ix].idx) return true;
 	return false;
 }
 void Plot::mergeMarkersAndCellInfo(Plot &source, Plot &target)
 {
-	auto &&smarkers = source.markers;
-	auto &&tmarkers = target.markers;
-
-	std::map<Marker::MarkerIndex, std::ptrdiff_t> indices;
-
-	auto first1 = smarkers.begin();
-	auto first2 = tmarkers.begin();
-	std::ptrdiff_t newIx{};
-	while (first1 != smarkers.end() && first2 != tmarkers.end()) {
-		if (auto cmp = first1->idx <=> first2->idx; std::is_lt(cmp)) {
-			indices.try_emplace(first1->idx, newIx);
-			first2 = tmarkers.emplace(first2, *first1);
-			first2->enabled = false;
+	const auto &smarkers = *source.markers;
+	const auto &tmarkers = *target.markers;
+
+	auto &&[smismatch, tmismatch] = std::ranges::mismatch(smarkers,
+	    tmarkers,
+	    {},
+	    &Marker::idx,
+	    &Marker::idx);
+
+	auto merged =
+	    smismatch != smarkers.end() || tmismatch != tmarkers.end();
+	if (merged) {
+		auto disabled = [](const Marker &marker)
+		{
+			auto res = marker;
+			res.enabled = false;
+			return res;
+		};
+
+		auto mergedSource = std::make_shared<Markers>();
+		auto mergedTarget = std::make_shared<Markers>();
+		mergedSource->reserve(smarkers.size() + tmarkers.size());
+		mergedTarget->reserve(smarkers.size() + tmarkers.size());
+
+		auto first1 = smarkers.begin();
+		auto first2 = tmarkers.begin();
+		while (first1 != smarkers.end() && first2 != tmarkers.end()) {
+			if (auto cmp = first1->idx <=> first2->idx;
+			    std::is_lt(cmp)) {
+				mergedTarget->push_back(disabled(*first1));
+				mergedSource->push_back(*first1++);
+			}
+			else if (std::is_gt(cmp)) {
+				mergedSource->push_back(disabled(*first2));
+				mergedTarget->push_back(*first2++);
+			}
+			else {
+				mergedSource->push_back(*first1++);
+				mergedTarget->push_back(*first2++);
+			}
+		}
+		for (; first1 != smarkers.end(); ++first1) {
+			mergedTarget->push_back(disabled(*first1));
+			mergedSource->push_back(*first1);
 		}
-		else if (std::is_gt(cmp)) {
-			indices.try_emplace(first2->idx, newIx);
-			first1 = smarkers.emplace(first1, *first2);
-			first1->enabled = false;
+		for (; first2 != tmarkers.end(); ++first2) {
+			mergedSource->push_back(disabled(*first2));
+			mergedTarget->push_back(*first2);
 		}
-		else
-			indices.try_emplace(first1->idx, newIx);
-		++first1;
-		++first2;
-		++newIx;
+
+		source.markers = std::move(mergedSource);
+		target.markers = std::move(mergedTarget);
 	}
 
-	if (first2 != tmarkers.end())
-		while (first2 != tmarkers.end()) {
-			indices.try_emplace(first2->idx, newIx++);
-			smarkers.emplace_back(*first2++).enabled = false;
-		}
-	else
-		while (first1 != smarkers.end()) {
-			indices.try_emplace(first1->idx, newIx++);
-			tmarkers.emplace_back(*first1++).enabled = false;
-		}
+	source.resolveMarkerLinks(target, merged);
+	target.resolveMarkerLinks(source, merged);
+}
 
+void Plot::resolveMarkerLinks(const Plot &other, bool ownsMarkers)
+{
+	const auto original = markers;
+	const auto &indices = *original;
+	auto indexOf = [&indices](const Marker::MarkerIndex &idx)
+	{
+		auto it = std::ranges::lower_bound(indices,
+		    idx,
+		    std::less{},
+		    &Marker::idx);
+		if (it == indices.end() || it->idx != idx)
+			throw std::out_of_range("invalid marker index");
+		return it - indices.begin();
+	};
+
+	const auto &others = *other.markers;
 	const auto markers_size =
 	    static_cast<std::ptrdiff_t>(indices.size());
 	for (std::ptrdiff_t ix{}; ix < markers_size; ++ix) {
-		auto &smarker = smarkers[ix];
-		auto &tmarker = tmarkers[ix];
-		if (auto &[idx, prePos] = smarker.prevMainMarker->value;
-		    !idx.empty())
-			prePos = indices.at(idx) - ix;
-
-		if (auto &[idx, prePos] = tmarker.prevMainMarker->value;
-		    !idx.empty())
-			prePos = indices.at(idx) - ix;
-
-		if (auto &scell = smarker.cellInfo, &tcell = tmarker.cellInfo;
-		    scell && !tcell)
-			tcell = scell;
-		else if (!scell && tcell)
-			scell = tcell;
+		const auto &marker = indices[ix];
+		const auto &[idx, prePos] =
+		    marker.prevMainMarker.get_or_first(::Anim::first).value;
+		auto pos = idx.empty() ? prePos : indexOf(idx) - ix;
+		const auto &cellInfo =
+		    marker.cellInfo ? marker.cellInfo : others[ix].cellInfo;
+
+		if (pos != prePos || cellInfo != marker.cellInfo) {
+			if (!std::exchange(ownsMarkers, true)) detachMarkers();
+			auto &modified = (*markers)[ix];
+			modified.prevMainMarker->value.distance = pos;
+			modified.cellInfo = cellInfo;
+		}
 	}
 }
 
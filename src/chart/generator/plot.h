@@ -62,9 +62,11 @@ public:
 	Plot(PlotOptionsPtr opts, Styles::Chart style);
 	[[nodiscard]] const Markers &getMarkers() const
 	{
-		return markers;
+		return *markers;
 	}
-	Markers &getMarkers() { return markers; }
+	// the markers must not be shared with other copies of the plot
+	Markers &mutableMarkers();
+	void detachMarkers();
 	void prependMarkers(const Plot &plot);
 	void appendMarkers(const Plot &plot);
 	[[nodiscard]] const MarkersInfo &getMarkersInfo() const
@@ -94,8 +96,11 @@ public:
 private:
 	PlotOptionsPtr options;
 	Styles::Chart style;
-	Markers markers;
+	// shared between the copies of the plot until detached
+	std::shared_ptr<Markers> markers{std::make_shared<Markers>()};
 	MarkersInfo markersInfo;
+
+	void resolveMarkerLinks(const Plot &other, bool ownsMarkers);
 };
 
 struct PlotParent
@@ -92,7 +92,7 @@ Buckets PlotBuilder::generateMarkers()
 		if (plot->getOptions()->geometry == ShapeType::area)
 			subIds.split_by(mainIds);
 
-		plot->markers.reserve(dataCube.df->get_record_count());
+		plot->markers->reserve(dataCube.df->get_record_count());
 	}
 
 	struct CmpBySec
@@ -116,7 +116,7 @@ Buckets PlotBuilder::generateMarkers()
 
 	for (auto first = set.begin(); auto &&index : dataCube)
 		for (auto &marker =
-		         plot->markers.emplace_back(*plot->getOptions(),
+		         plot->markers->emplace_back(*plot->getOptions(),
 		             dataCube,
 		             stats,
 		             mainIds,
@@ -130,12 +130,12 @@ Buckets PlotBuilder::generateMarkers()
 			plot->markersInfo.insert({first->get().first,
 			    Plot::MarkerInfo{Plot::MarkerInfoContent{marker}}});
 
-	if (!std::ranges::is_sorted(plot->markers, {}, &Marker::idx))
+	if (!std::ranges::is_sorted(*plot->markers, {}, &Marker::idx))
 		throw std::runtime_error(
 		    "One of your series name or category contains control "
 		    "character (possible tab/endline).");
 
-	return Buckets{plot->markers};
+	return Buckets{*plot->markers};
 }
 
 std::vector<PlotBuilder::BucketSortInfo> PlotBuilder::sortedBuckets(
@@ -201,7 +201,7 @@ std::vector<PlotBuilder::BucketSortInfo> PlotBuilder::sortedBuckets(
 void PlotBuilder::addSpecLayout(Buckets &buckets)
 {
 	auto geometry = plot->getOptions()->geometry->value;
-	if (auto &markers = plot->markers; isConnecting(geometry))
+	if (auto &markers = *plot->markers; isConnecting(geometry))
 		Charts::TableChart::setupVector(markers, true);
 	else if (!plot->getOptions()->isMeasure(ChannelId::size))
 		Charts::TableChart::setupVector(markers);
@@ -381,7 +381,7 @@ void PlotBuilder::calcAxises(const Data::DataTable &dataTable,
 	        {!mainAxis, subRanges.empty(), subBoundRect}}) {
 		if (!needRanges) continue;
 
-		for (auto &marker : plot->markers) {
+		for (auto &marker : *plot->markers) {
 			auto &&markerSize = marker.getSizeBy(axis);
 			if (!boundSize.positive().intersects(
 			        markerSize.positive()))
@@ -537,7 +537,7 @@ void PlotBuilder::calcAxis(const Data::DataTable &dataTable,
 		         || (plot->getOptions()->dimLabelIndex(+type) == 0
 		             && (axisProps.sort == Sort::none
 		                 || scale.dimensions().size() == 1));
-		     const auto &marker : plot->markers) {
+		     const auto &marker : *plot->markers) {
 			if (!marker.enabled) continue;
 
 			const auto &id =
@@ -772,7 +772,7 @@ void PlotBuilder::normalizeSizes()
 	    || plot->getOptions()->geometry == ShapeType::line) {
 		Math::Range<> size;
 
-		for (auto &marker : plot->markers) {
+		for (auto &marker : *plot->markers) {
 			if (std::isnan(marker.sizeFactor)) marker.enabled = false;
 			if (!marker.enabled) continue;
 			size.include(marker.sizeFactor);
@@ -783,7 +783,7 @@ void PlotBuilder::normalizeSizes()
 		           .at(ChannelId::size)
 		           .range.getRange(size);
 
-		for (auto &marker : plot->markers)
+		for (auto &marker : *plot->markers)
 			marker.sizeFactor = size.max == size.min
 			                      ? 0
 			                      : size.normalize(marker.sizeFactor);
@@ -791,7 +791,7 @@ void PlotBuilder::normalizeSizes()
 		stats.setIfRange(LegendId::size, size);
 	}
 	else
-		for (auto &marker : plot->markers) marker.sizeFactor = 0;
+		for (auto &marker : *plot->markers) marker.sizeFactor = 0;
 }
 
 void PlotBuilder::normalizeColors()
@@ -800,7 +800,7 @@ void PlotBuilder::normalizeColors()
 	Math::Range<> color;
 
 	bool wasValidMarker{};
-	for (auto &marker : plot->markers) {
+	for (auto &marker : *plot->markers) {
 		if (!marker.enabled) continue;
 		auto &&cbase = marker.colorBase.get();
 		if (!cbase.isDiscrete()) color.include(cbase.getPos());
@@ -822,7 +822,7 @@ void PlotBuilder::normalizeColors()
 	                .at(ChannelId::lightness)
 	                .range.getRange(lightness);
 
-	for (auto &marker : plot->markers) {
+	for (auto &marker : *plot->markers) {
 		auto &&cbase = marker.colorBase->value;
 		cbase.setLightness(lightness.rescale(cbase.getLightness()));
 
@@ -1,11 +1,14 @@
 #include "chart.h"
 
 #include <memory>
+#include <optional>
 #include <utility>
 
 #include "base/geom/rect.h"
 #include "base/gfx/canvas.h"
 #include "base/gfx/length.h"
+#include "base/gfx/textboundarycache.h"
+#include "base/util/profiler.h"
 #include "chart/animator/animation.h"
 #include "chart/generator/plot.h"
 #include "chart/generator/plotbuilder.h"
@@ -34,6 +37,8 @@ Chart::Chart() :
 	    [this](const Gen::PlotPtr &actPlot)
 	    {
 		    this->actPlot = actPlot;
+		    layoutKey.reset();
+		    ++renderCache.plotGeneration;
 		    onChanged();
 	    });
 	animator.onProgress.attach(
@@ -42,23 +47,36 @@ Chart::Chart() :
 		    events.animation.update->invoke(
 		        Events::OnUpdateEvent(animator.getControl()));
 	    });
+	animator.onKeyframeReady.attach(
+	    [this](const Gen::PlotPtr &plot)
+	    {
+		    setComputedStyles(*plot);
+	    });
 }
 
 void Chart::setBoundRect(const Geom::Rect &rect)
 {
 	if (actPlot) {
+		const LayoutKey key{rect,
+		    actStyles.fontSize.has_value(),
+		    Gfx::ICanvas::textBoundaryCache().getGeneration()};
+		if (layoutKey == key) return;
+
 		auto &style = actPlot->getStyle();
 		style.setup();
 		if (!actStyles.fontSize)
 			computedStyles.fontSize = style.fontSize = Gfx::Length{
 			    Styles::Sheet::baseFontSize(rect.size, true)};
 		layout.setBoundary(rect, style, actPlot->getOptions());
+		layoutKey = key;
 	}
 	else {
+		layoutKey.reset();
 		layout.setBoundary(rect,
 		    stylesheet.getDefaultParams(),
 		    nullptr);
 	}
+	++renderCache.plotGeneration;
 }
 
 void Chart::animate(Anim::Animation::OnComplete &&onComplete)
@@ -67,6 +85,8 @@ void Chart::animate(Anim::Animation::OnComplete &&onComplete)
 	    [this](const Gen::PlotPtr &plot, const bool &ok)
 	    {
 		    actPlot = plot;
+		    layoutKey.reset();
+		    ++renderCache.plotGeneration;
 		    if (ok) {
 			    prevOptions = *nextOptions;
 			    prevStyles = actStyles;
@@ -74,8 +94,7 @@ void Chart::animate(Anim::Animation::OnComplete &&onComplete)
 		    else {
 			    *nextOptions = prevOptions;
 			    setStyles(prevStyles);
-			    computedStyles = plot->getStyle();
-			    computedStyles.setup();
+			    setComputedStyles(*plot);
 		    }
 	    });
 
@@ -91,6 +110,14 @@ void Chart::setKeyframe()
 	nextOptions = std::make_shared<Gen::Options>(*nextOptions);
 }
 
+void Chart::setKeyframeAsync()
+{
+	animator.addKeyframeAsync(plotFactory(nextOptions),
+	    nextAnimOptions.keyframe);
+	nextAnimOptions.keyframe = Anim::Options::Keyframe();
+	nextOptions = std::make_shared<Gen::Options>(*nextOptions);
+}
+
 void Chart::setAnimation(const Anim::AnimationPtr &animation)
 {
 	animator.setAnimation(animation);
@@ -101,42 +128,118 @@ Gen::Config Chart::getConfig()
 	return Gen::Config{getOptions(), table};
 }
 
+void Chart::update()
+{
+	animator.update();
+}
+
 void Chart::draw(Gfx::ICanvas &canvas)
 {
-	renderedChart = Draw::RenderedChart{
-	    actPlot ? Draw::CoordinateSystem{layout.plotArea,
-	                  actPlot->getOptions()->angle,
-	                  actPlot->getOptions()->coordSystem,
-	                  actPlot->keepAspectRatio}
-	            : Draw::CoordinateSystem{layout.plotArea},
-	    actPlot};
-
-	Draw::DrawChart{
-	    Draw::DrawingContext{actPlot,
-	        actPlot ? actPlot->getOptions().get() : nullptr,
-	        renderedChart,
-	        renderedChart.getCoordSys(),
-	        actPlot ? actPlot->getStyle()
-	                : stylesheet.getDefaultParams(),
-	        events}}
+	const Util::Profiler::Scope profile{"Chart::draw"};
+
+	update();
+
+	draw(canvas,
+	    layout,
+	    actPlot,
+	    actPlot ? actPlot->getStyle() : stylesheet.getDefaultParams(),
+	    events,
+	    renderedChart,
+	    &renderCache);
+}
+
+Chart::Frame Chart::getFrame() const
+{
+	Frame res{nullptr, layout};
+	if (actPlot) {
+		res.plot = std::make_shared<Gen::Plot>(*actPlot);
+		res.plot->getStyle().setup();
+		res.plot->detachOptions();
+		res.plot->detachMarkers();
+	}
+	return res;
+}
+
+void Chart::drawFrame(Gfx::ICanvas &canvas, const Frame &frame)
+{
+	Util::EventDispatcher eventDispatcher;
+	Events events{eventDispatcher};
+	Draw::RenderedChart renderedChart;
+	// drawn through the same layers as the chart itself, so the
+	// recorded frames do not depend on the thread drawing them
+	Draw::RenderCache renderCache;
+
+	std::optional<Styles::Chart> defaultStyle;
+	if (!frame.plot) defaultStyle.emplace(Styles::Chart::def()).setup();
+
+	draw(canvas,
+	    frame.layout,
+	    frame.plot,
+	    frame.plot ? frame.plot->getStyle() : *defaultStyle,
+	    events,
+	    renderedChart,
+	    &renderCache);
+}
+
+void Chart::draw(Gfx::ICanvas &canvas,
+    const Layout &layout,
+    const Gen::PlotPtr &plot,
+    const Styles::Chart &style,
+    const Events &events,
+    Draw::RenderedChart &renderedChart,
+    Draw::RenderCache *renderCache)
+{
+	renderedChart.reset(
+	    plot ? Draw::CoordinateSystem{layout.plotArea,
+	               plot->getOptions()->angle,
+	               plot->getOptions()->coordSystem,
+	               plot->keepAspectRatio}
+	         : Draw::CoordinateSystem{layout.plotArea},
+	    plot);
+
+	Draw::DrawChart{Draw::DrawingContext{plot,
+	                    plot ? plot->getOptions().get() : nullptr,
+	                    renderedChart,
+	                    renderedChart.getCoordSys(),
+	                    style,
+	                    events,
+	                    renderCache}}
 	    .draw(canvas, layout);
 }
 
 Gen::PlotPtr Chart::plot(const Gen::PlotOptionsPtr &options)
+{
+	auto res = plotFactory(options)(table);
+
+	setComputedStyles(*res);
+
+	return res;
+}
+
+Anim::Animator::PlotFactory Chart::plotFactory(
+    const Gen::PlotOptionsPtr &options)
 {
 	options->setAutoParameters();
 
-	auto res = Gen::PlotBuilder{table,
-	    options,
-	    stylesheet.getFullParams(options, layout.boundary.size)}
-	               .build();
+	return [options,
+	           style = stylesheet.getFullParams(options,
+	               layout.boundary.size),
+	           size = layout.boundary.size](
+	           const Data::DataTable &table)
+	{
+		auto res = Gen::PlotBuilder{table, options, style}.build();
 
-	Styles::Sheet::setAfterStyles(*res, layout.boundary.size);
+		Styles::Sheet::setAfterStyles(*res, size);
 
-	computedStyles = res->getStyle();
-	computedStyles.setup();
+		return res;
+	};
+}
 
-	return res;
+void Chart::setComputedStyles(const Gen::Plot &plot)
+{
+	computedStyles = plot.getStyle();
+	computedStyles.setup();
+	layoutKey.reset();
 }
 
-}
\ No newline at end of file
+}
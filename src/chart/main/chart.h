@@ -1,11 +1,14 @@
 #ifndef VIZZU_CHART_H
 #define VIZZU_CHART_H
 
+#include <cstddef>
 #include <functional>
 #include <memory>
+#include <optional>
 #include <string>
 
 #include "base/anim/control.h"
+#include "base/geom/rect.h"
 #include "base/gfx/canvas.h"
 #include "base/gfx/pathsampler.h"
 #include "base/util/eventdispatcher.h"
@@ -14,6 +17,7 @@
 #include "chart/main/layout.h"
 #include "chart/main/stylesheet.h"
 #include "chart/options/config.h"
+#include "chart/rendering/rendercache.h"
 #include "chart/rendering/renderedchart.h"
 #include "dataframe/old/datatable.h"
 
@@ -26,11 +30,20 @@ namespace Vizzu
 class Chart
 {
 public:
+	struct Frame
+	{
+		Gen::PlotPtr plot;
+		Layout layout;
+	};
+
 	Util::Event<> onChanged;
 
 	Chart();
 	Chart(Chart &&) noexcept = delete;
+	void update();
 	void draw(Gfx::ICanvas &canvas);
+	[[nodiscard]] Frame getFrame() const;
+	static void drawFrame(Gfx::ICanvas &canvas, const Frame &frame);
 	void setBoundRect(const Geom::Rect &rect);
 
 	Data::DataTable &getTable() { return table; }
@@ -72,15 +85,36 @@ public:
 	{
 		return renderedChart;
 	}
+	[[nodiscard]] bool hasDrawListeners() const
+	{
+		return events.hasDrawListeners();
+	}
 
 	Gen::Config getConfig();
 
 	void animate(Anim::Animation::OnComplete &&onComplete);
 	void setKeyframe();
+	void setKeyframeAsync();
+	[[nodiscard]] bool isKeyframePreparing() const
+	{
+		return animator.isPreparing();
+	}
 	void setAnimation(const Anim::AnimationPtr &animation);
 
 private:
+	// inputs of the layout of the actual plot besides the plot itself,
+	// reset whenever the plot or its animation state changes
+	struct LayoutKey
+	{
+		Geom::Rect boundary;
+		bool fixedFontSize{};
+		std::size_t textGeneration{};
+
+		bool operator==(const LayoutKey &) const = default;
+	};
+
 	Layout layout;
+	std::optional<LayoutKey> layoutKey;
 	Data::DataTable table;
 	Gen::PlotPtr actPlot;
 	Gen::PlotOptionsPtr nextOptions;
@@ -92,10 +126,22 @@ private:
 	Styles::Chart computedStyles;
 	Util::EventDispatcher eventDispatcher;
 	Draw::RenderedChart renderedChart;
+	Draw::RenderCache renderCache;
 	Events events;
 	Anim::Animator animator;
 
 	Gen::PlotPtr plot(const Gen::PlotOptionsPtr &options);
+	Anim::Animator::PlotFactory plotFactory(
+	    const Gen::PlotOptionsPtr &options);
+	void setComputedStyles(const Gen::Plot &plot);
+
+	static void draw(Gfx::ICanvas &canvas,
+	    const Layout &layout,
+	    const Gen::PlotPtr &plot,
+	    const Styles::Chart &style,
+	    const Events &events,
+	    Draw::RenderedChart &renderedChart,
+	    Draw::RenderCache *renderCache);
 };
 
 }
@@ -1,5 +1,6 @@
 #include "events.h"
 
+#include "base/refl/auto_struct.h"
 #include "base/util/eventdispatcher.h"
 
 namespace Vizzu
@@ -38,4 +39,16 @@ Events::Events(Util::EventDispatcher &ed) :
         .complete = ed.createEvent("animation-complete")}
 {}
 
+bool Events::hasDrawListeners() const
+{
+	auto res = false;
+	Refl::visit(
+	    [&res](const Util::EventDispatcher::event_ptr &event)
+	    {
+		    res = res || event->hasListeners();
+	    },
+	    draw);
+	return res;
+}
+
 }
\ No newline at end of file
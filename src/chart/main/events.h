@@ -1,7 +1,10 @@
 #ifndef EVENTS_H
 #define EVENTS_H
 
+#include <memory_resource>
 #include <optional>
+#include <string>
+#include <string_view>
 
 #include "base/anim/control.h"
 #include "base/conv/auto_json.h"
@@ -9,6 +12,7 @@
 #include "base/geom/transformedrect.h"
 #include "base/text/smartstring.h"
 #include "base/util/eventdispatcher.h"
+#include "base/util/objectpool.h"
 #include "chart/generator/marker.h"
 #include "chart/options/channel.h"
 #include "chart/rendering/renderedchart.h"
@@ -20,6 +24,8 @@ class Events
 public:
 	explicit Events(Util::EventDispatcher &ed);
 
+	[[nodiscard]] bool hasDrawListeners() const;
+
 	struct OnUpdateDetail
 	{
 		::Anim::Duration position;
@@ -145,13 +151,13 @@ public:
 
 	struct Targets
 	{
+		using Pool = Util::ObjectPool;
+
 		struct Element : Util::EventTarget
 		{
-			std::string tagName;
+			std::string_view tagName;
 
-			explicit Element(std::string &&name) :
-			    tagName(std::move(name))
-			{}
+			explicit Element(std::string_view name) : tagName(name) {}
 
 			[[nodiscard]] std::string toJSON() const final
 			{
@@ -175,11 +181,10 @@ public:
 		struct ChildOf : ParentHolder<Parent>, Element
 		{
 			template <typename... Args>
-			explicit ChildOf(const std::string &name,
-			    Args &&...args) :
+			explicit ChildOf(std::string_view name, Args &&...args) :
 			    ParentHolder<Parent>{
 			        Parent{std::forward<Args>(args)...}},
-			    Element(this->parent.tagName + "-" + name)
+			    Element(name)
 			{}
 
 			void appendToJSON(Conv::JSONObj &&jsonObj) const override
@@ -191,17 +196,20 @@ public:
 
 		template <class Base> struct Text : Base
 		{
-			std::string text;
+			std::pmr::string text;
 
 			template <typename... Args>
-			explicit Text(std::string text, Args &&...args) :
+			explicit Text(std::string_view text,
+			    std::pmr::memory_resource *resource,
+			    Args &&...args) :
 			    Base(std::forward<Args>(args)...),
-			    text(std::move(text))
+			    text(text, resource)
 			{}
 
 			void appendToJSON(Conv::JSONObj &&jsonObj) const override
 			{
-				Base::appendToJSON(std::move(jsonObj)("value", text));
+				Base::appendToJSON(std::move(jsonObj)("value",
+				    std::string_view{text}));
 			}
 		};
 
@@ -277,7 +285,7 @@ public:
 			MarkerGuide(const Gen::Marker &marker,
 			    const Marker::DataPosition &position,
 			    Gen::AxisId axis) :
-			    MarkerChild("guide", marker, position),
+			    MarkerChild("plot-marker-guide", marker, position),
 			    axis(axis)
 			{}
 
@@ -290,185 +298,212 @@ public:
 
 		template <class Base> struct CategoryInfo : Base
 		{
-			std::string info;
+			std::pmr::string categoryName;
+			std::pmr::string categoryValue;
 
 			template <class... Args>
-			explicit CategoryInfo(
+			explicit CategoryInfo(std::pmr::memory_resource *resource,
 			    const std::string_view &categoryName,
 			    const std::string_view &categoryValue,
 			    Args &&...args) :
-			    Base(std::forward<Args>(args)...)
-			{
-				Conv::JSONObj{info}.template operator()<false>(
-				    categoryName,
-				    categoryValue);
-			}
+			    Base(std::forward<Args>(args)...),
+			    categoryName(categoryName, resource),
+			    categoryValue(categoryValue, resource)
+			{}
 
 			void appendToJSON(Conv::JSONObj &&jsonObj) const override
 			{
-				jsonObj.raw("categories", info);
+				jsonObj.nested("categories")
+				    .template operator()<false>(categoryName,
+				        std::string_view{categoryValue});
 				Base::appendToJSON(std::move(jsonObj));
 			}
 		};
 
-		static auto axis(Gen::AxisId axis)
+		static auto axis(Pool &pool, Gen::AxisId axis)
 		{
-			return std::make_unique<Axis>(axis);
+			return pool.make<Axis>(axis);
 		}
 
-		static auto legend(const LegendProperties &properties)
+		static auto legend(Pool &pool,
+		    const LegendProperties &properties)
 		{
-			return std::make_unique<Legend>(properties);
+			return pool.make<Legend>(properties);
 		}
 
-		static auto marker(const Gen::Marker &marker,
+		static auto marker(Pool &pool,
+		    const Gen::Marker &marker,
 		    const Marker::DataPosition &position)
 		{
-			return std::make_unique<Marker>(marker, position);
+			return pool.make<Marker>(marker, position);
 		}
 
-		static auto markerGuide(const Gen::Marker &marker,
+		static auto markerGuide(Pool &pool,
+		    const Gen::Marker &marker,
 		    const Marker::DataPosition &position,
 		    Gen::AxisId axis)
 		{
-			return std::make_unique<MarkerGuide>(marker,
-			    position,
-			    axis);
+			return pool.make<MarkerGuide>(marker, position, axis);
 		}
 
-		static auto root()
+		static auto root(Pool &pool)
 		{
-			return std::make_unique<Element>("root");
+			return pool.make<Element>("root");
 		}
 
-		static auto plot()
+		static auto plot(Pool &pool)
 		{
-			return std::make_unique<Element>("plot");
+			return pool.make<Element>("plot");
 		}
 
-		static auto area()
+		static auto area(Pool &pool)
 		{
-			return std::make_unique<Element>("plot-area");
+			return pool.make<Element>("plot-area");
 		}
 
-		static auto logo()
+		static auto logo(Pool &pool)
 		{
-			return std::make_unique<Element>("logo");
+			return pool.make<Element>("logo");
 		}
 
-		static auto chartTitle(const std::string &title)
+		static auto chartTitle(Pool &pool, const std::string &title)
 		{
-			return std::make_unique<Text<Element>>(title, "title");
+			return pool.make<Text<Element>>(title,
+			    pool.resource(),
+			    "title");
 		}
 
-		static auto chartSubtitle(const std::string &subtitle)
+		static auto chartSubtitle(Pool &pool,
+		    const std::string &subtitle)
 		{
-			return std::make_unique<Text<Element>>(subtitle,
+			return pool.make<Text<Element>>(subtitle,
+			    pool.resource(),
 			    "subtitle");
 		}
 
-		static auto chartCaption(const std::string &caption)
+		static auto chartCaption(Pool &pool,
+		    const std::string &caption)
 		{
-			return std::make_unique<Text<Element>>(caption,
+			return pool.make<Text<Element>>(caption,
+			    pool.resource(),
 			    "caption");
 		}
 
-		static auto markerLabel(const std::string &label,
+		static auto markerLabel(Pool &pool,
+		    const std::string &label,
 		    const Gen::Marker &marker,
 		    const Marker::DataPosition &position)
 		{
-			return std::make_unique<Text<MarkerChild>>(label,
-			    "label",
+			return pool.make<Text<MarkerChild>>(label,
+			    pool.resource(),
+			    "plot-marker-label",
 			    marker,
 			    position);
 		}
 
-		static auto dimLegendLabel(
+		static auto dimLegendLabel(Pool &pool,
 		    const std::string_view &categoryName,
 		    const std::string &categoryValue,
 		    const LegendProperties &properties)
 		{
-			return std::make_unique<CategoryInfo<Text<LegendChild>>>(
+			return pool.make<CategoryInfo<Text<LegendChild>>>(
+			    pool.resource(),
 			    categoryName,
 			    categoryValue,
 			    categoryValue,
-			    "label",
+			    pool.resource(),
+			    "legend-label",
 			    properties);
 		}
 
-		static auto measLegendLabel(const std::string &label,
+		static auto measLegendLabel(Pool &pool,
+		    const std::string &label,
 		    const LegendProperties &properties)
 		{
-			return std::make_unique<Text<LegendChild>>(label,
-			    "label",
+			return pool.make<Text<LegendChild>>(label,
+			    pool.resource(),
+			    "legend-label",
 			    properties);
 		}
 
-		static auto legendTitle(const std::string &title,
+		static auto legendTitle(Pool &pool,
+		    const std::string &title,
 		    const LegendProperties &properties)
 		{
-			return std::make_unique<Text<LegendChild>>(title,
-			    "title",
+			return pool.make<Text<LegendChild>>(title,
+			    pool.resource(),
+			    "legend-title",
 			    properties);
 		}
 
-		static auto legendMarker(const std::string_view &categoryName,
+		static auto legendMarker(Pool &pool,
+		    const std::string_view &categoryName,
 		    const std::string_view &categoryValue,
 		    const LegendProperties &properties)
 		{
-			return std::make_unique<CategoryInfo<LegendChild>>(
+			return pool.make<CategoryInfo<LegendChild>>(
+			    pool.resource(),
 			    categoryName,
 			    categoryValue,
-			    "marker",
+			    "legend-marker",
 			    properties);
 		}
 
-		static auto legendBar(const LegendProperties &properties)
+		static auto legendBar(Pool &pool,
+		    const LegendProperties &properties)
 		{
-			return std::make_unique<LegendChild>("bar", properties);
+			return pool.make<LegendChild>("legend-bar", properties);
 		}
 
-		static auto dimAxisLabel(const std::string_view &categoryName,
+		static auto dimAxisLabel(Pool &pool,
+		    const std::string_view &categoryName,
 		    const std::string &categoryValue,
 		    Gen::AxisId axis)
 		{
-			return std::make_unique<CategoryInfo<Text<AxisChild>>>(
+			return pool.make<CategoryInfo<Text<AxisChild>>>(
+			    pool.resource(),
 			    categoryName,
 			    categoryValue,
 			    categoryValue,
-			    "label",
+			    pool.resource(),
+			    "plot-axis-label",
 			    axis);
 		}
 
-		static auto measAxisLabel(const std::string &label,
+		static auto measAxisLabel(Pool &pool,
+		    const std::string &label,
 		    Gen::AxisId axis)
 		{
-			return std::make_unique<Text<AxisChild>>(label,
-			    "label",
+			return pool.make<Text<AxisChild>>(label,
+			    pool.resource(),
+			    "plot-axis-label",
 			    axis);
 		}
 
-		static auto axisTitle(const std::string &title,
+		static auto axisTitle(Pool &pool,
+		    const std::string &title,
 		    Gen::AxisId axis)
 		{
-			return std::make_unique<Text<AxisChild>>(title,
-			    "title",
+			return pool.make<Text<AxisChild>>(title,
+			    pool.resource(),
+			    "plot-axis-title",
 			    axis);
 		}
 
-		static auto axisGuide(Gen::AxisId axis)
+		static auto axisGuide(Pool &pool, Gen::AxisId axis)
 		{
-			return std::make_unique<AxisChild>("guide", axis);
+			return pool.make<AxisChild>("plot-axis-guide", axis);
 		}
 
-		static auto axisTick(Gen::AxisId axis)
+		static auto axisTick(Pool &pool, Gen::AxisId axis)
 		{
-			return std::make_unique<AxisChild>("tick", axis);
+			return pool.make<AxisChild>("plot-axis-tick", axis);
 		}
 
-		static auto axisInterlacing(Gen::AxisId axis)
+		static auto axisInterlacing(Pool &pool, Gen::AxisId axis)
 		{
-			return std::make_unique<AxisChild>("interlacing", axis);
+			return pool.make<AxisChild>("plot-axis-interlacing",
+			    axis);
 		}
 	};
 };
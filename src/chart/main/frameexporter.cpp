@@ -0,0 +1,110 @@
+#include "frameexporter.h"
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <stdexcept>
+#include <vector>
+
+#include "base/anim/duration.h"
+#include "base/geom/rect.h"
+#include "base/gfx/canvas.h"
+
+#include "chart.h"
+
+namespace Vizzu
+{
+
+FrameExporter::FrameExporter(Chart &chart,
+    const Geom::Size &size,
+    const Options &options) :
+    chart(chart),
+    size(size),
+    options(options)
+{
+	if (!(this->options.fps > 0.0))
+		throw std::invalid_argument("invalid frame rate");
+#if defined(__EMSCRIPTEN__) && !defined(__EMSCRIPTEN_PTHREADS__)
+	this->options.threads = 1;
+#else
+	if (this->options.threads == 0) this->options.threads = 1;
+#endif
+}
+
+std::size_t FrameExporter::run(const CanvasFactory &createCanvas,
+    const Sink &sink)
+{
+	auto control = chart.getAnimControl();
+	if (!control) throw std::logic_error("no animation to export");
+
+	const auto threads =
+	    chart.hasDrawListeners() ? std::size_t{1} : options.threads;
+
+	std::vector<Chart::Frame> frames;
+	std::size_t first{};
+	std::size_t frame{};
+	for (auto running = true; running; ++frame) {
+		step(frame);
+		running = control->isRunning();
+
+		if (threads == 1) {
+			auto canvas = createCanvas();
+			canvas->frameBegin();
+			chart.draw(*canvas);
+			canvas->frameEnd();
+			sink(frame, *canvas);
+			continue;
+		}
+
+		chart.update();
+		frames.push_back(chart.getFrame());
+		if (frames.size() == threads || !running) {
+			flush(frames, first, createCanvas, sink);
+			first = frame + 1;
+		}
+	}
+	return frame;
+}
+
+void FrameExporter::step(std::size_t frame)
+{
+	// the first update only initializes the animation clock,
+	// so the timeline starts one frame after the epoch
+	auto time = std::chrono::duration_cast<std::chrono::nanoseconds>(
+	    std::chrono::duration<double>{
+	        static_cast<double>(frame + 1) / options.fps});
+
+	chart.getAnimControl()->update(::Anim::TimePoint{time});
+	chart.setBoundRect(Geom::Rect(Geom::Point{}, size));
+}
+
+void FrameExporter::flush(std::vector<Chart::Frame> &frames,
+    std::size_t first,
+    const CanvasFactory &createCanvas,
+    const Sink &sink) const
+{
+	std::vector<std::unique_ptr<Gfx::ICanvas>> canvases;
+	std::vector<std::future<void>> rendered;
+	canvases.reserve(frames.size());
+	rendered.reserve(frames.size());
+
+	for (const auto &frame : frames)
+		rendered.push_back(std::async(std::launch::async,
+		    [&canvas = *canvases.emplace_back(createCanvas()),
+		        &frame]
+		    {
+			    canvas.frameBegin();
+			    Chart::drawFrame(canvas, frame);
+			    canvas.frameEnd();
+		    }));
+
+	for (auto &result : rendered) result.wait();
+	for (std::size_t ix{}; ix < rendered.size(); ++ix) {
+		rendered[ix].get();
+		sink(first + ix, *canvases[ix]);
+	}
+	frames.clear();
+}
+
+}
@@ -0,0 +1,59 @@
+#ifndef FRAMEEXPORTER_H
+#define FRAMEEXPORTER_H
+
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <vector>
+
+#include "base/geom/point.h"
+#include "base/gfx/canvas.h"
+
+#include "chart.h"
+
+namespace Vizzu
+{
+
+// Draws the running animation of a chart frame by frame at a fixed
+// frame rate. With more than one thread, the frames are snapshotted
+// on the caller thread and drawn in parallel, unless draw event
+// listeners are attached, as those are called only from the caller
+// thread. The parallel frames share the process-wide text measurement
+// cache (Gfx::ICanvas::textBoundaryCache()), the text measurement
+// function of the build (Gfx::ICanvas::measureText) and
+// Util::Profiler, these must stay thread-safe.
+class FrameExporter
+{
+public:
+	struct Options
+	{
+		double fps{60.0};
+		std::size_t threads{1};
+	};
+
+	using CanvasFactory =
+	    std::function<std::unique_ptr<Gfx::ICanvas>()>;
+	using Sink = std::function<void(std::size_t, Gfx::ICanvas &)>;
+
+	FrameExporter(Chart &chart,
+	    const Geom::Size &size,
+	    const Options &options);
+
+	std::size_t run(const CanvasFactory &createCanvas,
+	    const Sink &sink);
+
+private:
+	Chart &chart;
+	Geom::Size size;
+	Options options;
+
+	void step(std::size_t frame);
+	void flush(std::vector<Chart::Frame> &frames,
+	    std::size_t first,
+	    const CanvasFactory &createCanvas,
+	    const Sink &sink) const;
+};
+
+}
+
+#endif
@@ -178,7 +178,8 @@ Chart Chart::def()
 									OrientedLabelParams
 									{
 										.orientation = Anim::Interpolated<OrientedLabel::Orientation>(OrientedLabel::Orientation::horizontal),
-										.angle = Geom::Angle180()
+										.angle = Geom::Angle180(),
+										.overlap = Anim::Interpolated<Overlap>(Overlap::visible)
 									}
 								},
 								MarkerLabelParams
@@ -259,7 +260,8 @@ Chart Chart::def()
 								OrientedLabelParams
 								{
 									.orientation = Anim::Interpolated<OrientedLabel::Orientation>(OrientedLabel::Orientation::horizontal),
-									.angle = Geom::Angle180()
+									.angle = Geom::Angle180(),
+									.overlap = Anim::Interpolated<Overlap>(Overlap::visible)
 								}
 							},
 							AxisLabelParams
@@ -352,6 +354,7 @@ Chart Chart::def()
 								{
 									.orientation = Anim::Interpolated<OrientedLabel::Orientation>(OrientedLabel::Orientation::horizontal),
 									.angle = Geom::Angle180(),
+									.overlap = Anim::Interpolated<Overlap>(Overlap::visible)
 								}
 							},
 							AxisLabelParams
@@ -27,6 +27,7 @@ using ::Style::Param;
 
 enum class Visibility : std::uint8_t { hidden, visible };
 enum class Overflow : std::uint8_t { hidden, visible };
+enum class Overlap : std::uint8_t { visible, hidden };
 
 struct Padding
 {
@@ -104,7 +105,7 @@ struct Font
 		throw std::logic_error("internal error: no font parent set");
 	}
 
-	[[nodiscard]] std::string calculatedFamily() const
+	[[nodiscard]] const std::string &calculatedFamily() const
 	{
 		if (fontFamily.has_value())
 			if (auto &&ff = fontFamily->values[::Anim::first].value;
@@ -190,6 +191,7 @@ struct OrientedLabelParams
 
 	Param<::Anim::Interpolated<Orientation>> orientation;
 	Param<Geom::Angle180> angle;
+	Param<::Anim::Interpolated<Overlap>> overlap;
 };
 
 struct OrientedLabel : Label, OrientedLabelParams
@@ -16,6 +16,7 @@
 #include "base/math/range.h"
 #include "base/refl/auto_accessor.h"
 #include "base/style/impl.tpp"
+#include "base/style/paramcomparer.h"
 #include "chart/generator/plot.h"
 #include "chart/options/channel.h"
 #include "chart/options/coordsystem.h"
@@ -43,9 +44,51 @@ Chart Sheet::getFullParams(const Gen::PlotOptionsPtr &options,
 {
 	this->options = options.get();
 
+	auto key = defaultsKey(size);
+	if (auto it = std::ranges::find_if(resolved,
+	        [this, &key](const Resolved &entry)
+	        {
+		        return entry.key == key
+		            && ::Style::ParamComparer::equals(entry.active,
+		                activeParams.get());
+	        });
+	    it != resolved.end()) {
+		std::rotate(resolved.begin(), it, it + 1);
+		auto &entry = resolved.front();
+		if (entry.id != defaultsId) {
+			defaultParams = entry.defaults;
+			defaultsId = entry.id;
+		}
+		return entry.full;
+	}
+
 	calcDefaults(size);
+	auto full = Base::getFullParams();
+
+	if (resolved.size() == cacheSize) resolved.pop_back();
+	defaultsId = ++nextId;
+	resolved.insert(resolved.begin(),
+	    {defaultsId, key, activeParams.get(), defaultParams, full});
 
-	return Base::getFullParams();
+	return full;
+}
+
+Sheet::DefaultsKey Sheet::defaultsKey(const Geom::Size &size) const
+{
+	const auto &channels = options->getChannels();
+	return {options->coordSystem,
+	    options->geometry,
+	    channels.anyAxisSet(),
+	    options->isHorizontal(),
+	    options->getHorizontalChannel(),
+	    options->isMeasure(Gen::ChannelId::x),
+	    options->isMeasure(Gen::ChannelId::y),
+	    options->isMeasure(Gen::ChannelId::size),
+	    channels.at(Gen::ChannelId::x).hasDimension(),
+	    channels.at(Gen::ChannelId::y).hasDimension(),
+	    channels.at(Gen::ChannelId::y).isEmpty(),
+	    channels.at(Gen::ChannelId::size).isEmpty(),
+	    baseFontSize(size, true)};
 }
 
 void Sheet::calcDefaults(const Geom::Size &size)
@@ -1,8 +1,14 @@
 #ifndef STYLESHEET_H
 #define STYLESHEET_H
 
+#include <cstddef>
+#include <vector>
+
+#include "base/anim/interpolated.h"
 #include "base/style/sheet.h"
+#include "chart/options/coordsystem.h"
 #include "chart/options/options.h"
+#include "chart/options/shapetype.h"
 
 #include "style.h"
 
@@ -34,6 +40,8 @@ public:
 		this->defaultParams.setup();
 	}
 
+	static constexpr std::size_t cacheSize = 4;
+
 	Chart getFullParams(const Gen::PlotOptionsPtr &options,
 	    const Geom::Size &size);
 
@@ -45,7 +53,42 @@ public:
 private:
 	using Base::getFullParams;
 
+	// every option and size dependent input of calcDefaults()
+	struct DefaultsKey
+	{
+		::Anim::Interpolated<Gen::CoordSystem> coordSystem;
+		::Anim::Interpolated<Gen::ShapeType> geometry;
+		bool anyAxisSet{};
+		bool horizontal{};
+		Gen::AxisId horizontalChannel{};
+		bool xIsMeasure{};
+		bool yIsMeasure{};
+		bool sizeIsMeasure{};
+		bool xHasDimension{};
+		bool yHasDimension{};
+		bool yIsEmpty{};
+		bool sizeIsEmpty{};
+		double fontSize{};
+
+		bool operator==(const DefaultsKey &) const = default;
+	};
+
+	struct Resolved
+	{
+		std::size_t id;
+		DefaultsKey key;
+		Chart active;
+		Chart defaults;
+		Chart full;
+	};
+
 	const Gen::Options *options{};
+	std::vector<Resolved> resolved;
+	std::size_t nextId{};
+	std::size_t defaultsId{};
+
+	[[nodiscard]] DefaultsKey defaultsKey(
+	    const Geom::Size &size) const;
 
 	void calcDefaults(const Geom::Size &size);
 
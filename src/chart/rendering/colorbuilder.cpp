@@ -1,14 +1,19 @@
 
 #include "colorbuilder.h"
 
+#include <algorithm>
 #include <cstddef>
 #include <cstdint>
+#include <numeric>
+#include <span>
 
 #include "base/anim/interpolated.h"
 #include "base/gfx/color.h"
 #include "base/gfx/colorgradient.h"
 #include "base/gfx/colorpalette.h"
+#include "base/math/interpolation.h"
 #include "chart/generator/colorbase.h"
+#include "chart/generator/marker.h"
 
 namespace Vizzu::Draw
 {
@@ -23,6 +28,13 @@ ColorBuilder::ColorBuilder(const LightnessRange &lightnessRange,
 
 Gfx::Color ColorBuilder::render(
     const Anim::Interpolated<Gen::ColorBase> &colorBase) const
+{
+	return render(colorBase, nullptr);
+}
+
+Gfx::Color ColorBuilder::render(
+    const Anim::Interpolated<Gen::ColorBase> &colorBase,
+    const Tables *tables) const
 {
 	if (!colorBase.get_or_first(::Anim::first).value.isDiscrete()
 	    && !colorBase.get_or_first(::Anim::second)
@@ -37,22 +49,76 @@ Gfx::Color ColorBuilder::render(
 		    {
 			    return base.getLightness();
 		    });
-		return lightnessAdjusted(gradient(pos), lightness);
+		return lightnessAdjusted(gradientColor(pos, tables),
+		    lightness);
 	}
 	return colorBase.combine(
-	    [this](const Gen::ColorBase &base)
+	    [this, tables](const Gen::ColorBase &base)
 	    {
-		    return lightnessAdjusted(baseColor(base),
+		    return lightnessAdjusted(baseColor(base, tables),
 		        base.getLightness());
 	    });
 }
 
 Gfx::Color ColorBuilder::render(const Gen::ColorBase &colorBase) const
 {
-	return lightnessAdjusted(baseColor(colorBase),
+	return lightnessAdjusted(baseColor(colorBase, nullptr),
 	    colorBase.getLightness());
 }
 
+void ColorBuilder::render(std::span<const Gen::Marker> markers,
+    std::span<Gfx::Color> colors,
+    Tables &tables) const
+{
+	auto needsGradient = std::ranges::any_of(markers,
+	    [](const Gen::Marker &marker)
+	    {
+		    return !marker.colorBase.get_or_first(::Anim::first)
+		                .value.isDiscrete()
+		        || !marker.colorBase.get_or_first(::Anim::second)
+		                .value.isDiscrete();
+	    });
+	prepare(tables, markers.size(), needsGradient);
+
+	for (auto i = 0U; i < markers.size(); ++i)
+		colors[i] = render(markers[i].colorBase, &tables);
+}
+
+void ColorBuilder::prepare(Tables &tables,
+    std::size_t markerCount,
+    bool needsGradient) const
+{
+	if (!tables.key || tables.key->lightnessRange != lightnessRange
+	    || tables.key->palette != palette.get()
+	    || tables.key->gradient != gradient.get()) {
+		tables.key.emplace(lightnessRange, palette, gradient);
+		tables.palette.clear();
+		tables.gradient.clear();
+	}
+
+	const auto &palette = this->palette.get();
+	auto period = std::lcm(
+	    std::max<std::size_t>(1,
+	        palette.get_or_first(::Anim::first).value.size()),
+	    std::max<std::size_t>(1,
+	        palette.get_or_first(::Anim::second).value.size()));
+
+	if (tables.palette.empty() && period <= maxPalettePeriod
+	    && period < markerCount) {
+		tables.palette.reserve(period);
+		for (auto i = 0U; i < period; ++i)
+			tables.palette.push_back(indexedColor(i));
+	}
+
+	if (tables.gradient.empty() && needsGradient
+	    && gradientResolution < markerCount) {
+		tables.gradient.reserve(gradientResolution + 1);
+		for (auto i = 0U; i <= gradientResolution; ++i)
+			tables.gradient.push_back(gradient(
+			    static_cast<double>(i) / gradientResolution));
+	}
+}
+
 Gfx::Color ColorBuilder::lightnessAdjusted(const Gfx::Color &color,
     double lightness) const
 {
@@ -60,11 +126,36 @@ Gfx::Color ColorBuilder::lightnessAdjusted(const Gfx::Color &color,
 	return color.lightnessScaled(factor);
 }
 
-Gfx::Color ColorBuilder::baseColor(
-    const Gen::ColorBase &colorBase) const
+Gfx::Color ColorBuilder::baseColor(const Gen::ColorBase &colorBase,
+    const Tables *tables) const
 {
-	return colorBase.isDiscrete() ? indexedColor(colorBase.getIndex())
-	                              : gradient(colorBase.getPos());
+	return colorBase.isDiscrete()
+	         ? paletteColor(colorBase.getIndex(), tables)
+	         : gradientColor(colorBase.getPos(), tables);
+}
+
+Gfx::Color ColorBuilder::paletteColor(const uint32_t &colorIndex,
+    const Tables *tables) const
+{
+	return !tables || tables->palette.empty()
+	         ? indexedColor(colorIndex)
+	         : tables->palette[colorIndex % tables->palette.size()];
+}
+
+Gfx::Color ColorBuilder::gradientColor(double pos,
+    const Tables *tables) const
+{
+	if (!tables || tables->gradient.empty()
+	    || !(pos >= 0.0 && pos <= 1.0))
+		return gradient(pos);
+
+	const auto &gradientTable = tables->gradient;
+	auto scaled = pos * gradientResolution;
+	auto index = std::min(static_cast<std::size_t>(scaled),
+	    gradientResolution - 1);
+	return Math::interpolate(gradientTable[index],
+	    gradientTable[index + 1],
+	    scaled - static_cast<double>(index));
 }
 
 [[nodiscard]] Gfx::Color ColorBuilder::indexedColor(
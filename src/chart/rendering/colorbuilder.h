@@ -1,6 +1,11 @@
 #ifndef COLORBUILDER_H
 #define COLORBUILDER_H
 
+#include <cstddef>
+#include <optional>
+#include <span>
+#include <vector>
+
 #include "base/anim/interpolated.h"
 #include "base/gfx/color.h"
 #include "base/gfx/colorgradient.h"
@@ -8,6 +13,11 @@
 #include "base/math/range.h"
 #include "chart/generator/colorbase.h"
 
+namespace Vizzu::Gen
+{
+class Marker;
+}
+
 namespace Vizzu::Draw
 {
 
@@ -15,6 +25,28 @@ struct ColorBuilder
 {
 	using LightnessRange = Math::Range<>;
 
+	static constexpr std::size_t gradientResolution = 1024;
+	static constexpr std::size_t maxPalettePeriod = 4096;
+
+	// Lookup tables of a bulk render, owned by the caller so that
+	// they can be reused between frames while their inputs are
+	// unchanged.
+	struct Tables
+	{
+		struct Key
+		{
+			LightnessRange lightnessRange;
+			::Anim::Interpolated<Gfx::ColorPalette> palette;
+			Gfx::ColorGradient gradient;
+
+			bool operator==(const Key &) const = default;
+		};
+
+		std::optional<Key> key;
+		std::vector<Gfx::Color> palette;
+		std::vector<Gfx::Color> gradient;
+	};
+
 	ColorBuilder(const LightnessRange &lightnessRange,
 	    const ::Anim::Interpolated<Gfx::ColorPalette> &palette,
 	    const Gfx::ColorGradient &gradient);
@@ -25,6 +57,16 @@ struct ColorBuilder
 	[[nodiscard]] Gfx::Color render(
 	    const Gen::ColorBase &colorBase) const;
 
+	void render(std::span<const Gen::Marker> markers,
+	    std::span<Gfx::Color> colors,
+	    Tables &tables) const;
+
+	// Builds the tables which pay off for the given marker count:
+	// a table is only built if it has fewer entries than markers.
+	void prepare(Tables &tables,
+	    std::size_t markerCount,
+	    bool needsGradient) const;
+
 private:
 	LightnessRange lightnessRange;
 
@@ -33,12 +75,24 @@ private:
 	    const ::Anim::Interpolated<Gfx::ColorPalette>>
 	    palette;
 
+	[[nodiscard]] Gfx::Color render(
+	    const ::Anim::Interpolated<Gen::ColorBase> &colorBase,
+	    const Tables *tables) const;
+
 	[[nodiscard]] Gfx::Color baseColor(
-	    const Gen::ColorBase &colorBase) const;
+	    const Gen::ColorBase &colorBase,
+	    const Tables *tables) const;
 
 	[[nodiscard]] Gfx::Color indexedColor(
 	    const uint32_t &colorIndex) const;
 
+	[[nodiscard]] Gfx::Color paletteColor(
+	    const uint32_t &colorIndex,
+	    const Tables *tables) const;
+
+	[[nodiscard]] Gfx::Color gradientColor(double pos,
+	    const Tables *tables) const;
+
 	[[nodiscard]] Gfx::Color lightnessAdjusted(
 	    const Gfx::Color &color,
 	    double lightness) const;
@@ -34,6 +34,7 @@
 #include "drawinterlacing.h"
 #include "drawlabel.h"
 #include "orientedlabel.h"
+#include "rendercache.h"
 #include "renderedchart.h"
 
 namespace Vizzu::Draw
@@ -143,8 +144,10 @@ const DrawAxes &&DrawAxes::init() &&
 		    axis.parts.empty() ? oneSized : axis.parts;
 
 		auto measEnabled = axis.measure.enabled.combine<double>();
-		auto &intervals = this->intervals[axisIndex];
-		auto &separators = this->separators[axisIndex];
+		auto &intervals = buffers.intervals[axisIndex];
+		auto &separators = buffers.separators[axisIndex];
+		intervals.clear();
+		separators.clear();
 		const auto &guides = plot->guides.at(axisIndex);
 
 		for (auto &&[index, item] : axis.dimension.getValues()) {
@@ -188,44 +191,78 @@ const DrawAxes &&DrawAxes::init() &&
 				separators.emplace_back(item.range.min, sepWeight);
 		}
 
-		if (measEnabled == 0.0) continue;
-		auto step = axis.measure.step.combine();
-
-		using Math::Floating::less;
-
-		auto &&[min, max] = std::minmax(
-		    axis.measure.step.get_or_first(::Anim::first).value,
-		    axis.measure.step.get_or_first(::Anim::second).value,
-		    less);
-
-		auto stepHigh =
-		    std::clamp(Math::Renard::R5().ceil(step), min, max, less);
-		auto stepLow = std::clamp(Math::Renard::R5().floor(step),
-		    min,
-		    max,
-		    less);
-
-		if (Math::Floating::is_zero(axis.measure.range.size()))
-			step = stepHigh = stepLow = 1.0;
-
-		if (stepHigh == step || stepLow == step)
-			generateMeasure(axisIndex, step, measEnabled);
-		else {
-			auto highWeight =
-			    Math::Range<>{stepLow, stepHigh}.rescale(step);
-
-			generateMeasure(axisIndex,
-			    stepLow,
-			    (1.0 - highWeight) * measEnabled);
-			generateMeasure(axisIndex,
-			    stepHigh,
-			    highWeight * measEnabled);
-		}
+		if (measEnabled != 0.0) generateMeasure(axisIndex, measEnabled);
 	}
 
 	return std::move(*this);
 }
 
+void DrawAxes::generateMeasure(Gen::AxisId axisIndex,
+    double measEnabled)
+{
+	const auto &axis = plot->axises.at(axisIndex);
+	auto &intervals = buffers.intervals[axisIndex];
+	auto &separators = buffers.separators[axisIndex];
+
+	MeasureTicks::Key key{measEnabled,
+	    axis.measure.step,
+	    axis.measure.range,
+	    origo()};
+	auto *ticks = cache ? &cache->measureTicks[axisIndex] : nullptr;
+	if (ticks && ticks->key == key) {
+		for (const auto &interval : ticks->intervals)
+			intervals.push_back(interval);
+		for (const auto &separator : ticks->separators)
+			separators.push_back(separator);
+		return;
+	}
+
+	auto firstInterval = intervals.size();
+	auto firstSeparator = separators.size();
+
+	auto step = axis.measure.step.combine();
+
+	using Math::Floating::less;
+
+	auto &&[min, max] = std::minmax(
+	    axis.measure.step.get_or_first(::Anim::first).value,
+	    axis.measure.step.get_or_first(::Anim::second).value,
+	    less);
+
+	auto stepHigh =
+	    std::clamp(Math::Renard::R5().ceil(step), min, max, less);
+	auto stepLow = std::clamp(Math::Renard::R5().floor(step),
+	    min,
+	    max,
+	    less);
+
+	if (Math::Floating::is_zero(axis.measure.range.size()))
+		step = stepHigh = stepLow = 1.0;
+
+	if (stepHigh == step || stepLow == step)
+		generateMeasure(axisIndex, step, measEnabled);
+	else {
+		auto highWeight = Math::Range<>{stepLow, stepHigh}.rescale(step);
+
+		generateMeasure(axisIndex,
+		    stepLow,
+		    (1.0 - highWeight) * measEnabled);
+		generateMeasure(axisIndex,
+		    stepHigh,
+		    highWeight * measEnabled);
+	}
+
+	if (ticks) {
+		ticks->key = std::move(key);
+		ticks->intervals.clear();
+		ticks->separators.clear();
+		for (auto i = firstInterval; i < intervals.size(); ++i)
+			ticks->intervals.push_back(intervals[i]);
+		for (auto i = firstSeparator; i < separators.size(); ++i)
+			ticks->separators.push_back(separators[i]);
+	}
+}
+
 void DrawAxes::generateMeasure(Gen::AxisId axisIndex,
     double stepSize,
     double weight)
@@ -267,8 +304,8 @@ void DrawAxes::generateMeasure(Gen::AxisId axisIndex,
 		return x.second <= 1.0;
 	};
 
-	auto &separators = this->separators[axisIndex];
-	auto &intervals = this->intervals[axisIndex];
+	auto &separators = buffers.separators[axisIndex];
+	auto &intervals = buffers.intervals[axisIndex];
 
 	for (auto &&[i, bottom] :
 	    std::views::iota(0) | std::views::transform(Transform)
@@ -325,7 +362,9 @@ void DrawAxes::drawAxis(Gen::AxisId axisIndex,
 		canvas.setLineColor(lineColor);
 		canvas.setLineWidth(1.0);
 
-		if (auto &&eventTarget = Events::Targets::axis(axisIndex);
+		if (auto &&eventTarget = Events::Targets::axis(
+		        renderedChart.getTargetPool(),
+		        axisIndex);
 
 		    rootEvents.draw.plot.axis.base->invoke(
 		        Events::OnLineDrawEvent(*eventTarget,
@@ -494,7 +533,9 @@ void DrawAxes::drawTitle(Gen::AxisId axisIndex,
 		    title.value,
 		    titleStyle,
 		    *rootEvents.draw.plot.axis.title,
-		    Events::Targets::axisTitle(title.value, axisIndex),
+		    Events::Targets::axisTitle(renderedChart.getTargetPool(),
+		        title.value,
+		        axisIndex),
 		    {.colorTransform = Gfx::ColorTransform::Opacity(weight),
 		        .flip = upsideDown});
 
@@ -518,6 +559,10 @@ void DrawAxes::drawDimensionLabels(Gen::AxisId axisIndex,
 		canvas.setFont(Gfx::Font{labelStyle});
 		const auto &enabled = plot->guides.at(axisIndex);
 
+		std::optional<LabelLayout> layout;
+		if (labelStyle.overlap == Styles::Overlap::hidden)
+			layout.emplace();
+
 		for (const auto &interval : getIntervals(axisIndex)) {
 			if (!interval.label) continue;
 			drawDimensionLabel(axisIndex,
@@ -526,7 +571,8 @@ void DrawAxes::drawDimensionLabels(Gen::AxisId axisIndex,
 			    tr,
 			    Math::FuzzyBool::And<double>(w,
 			        interval.weight,
-			        enabled.labels));
+			        enabled.labels),
+			    layout ? &*layout : nullptr);
 		}
 	}
 }
@@ -535,7 +581,8 @@ void DrawAxes::drawDimensionLabel(Gen::AxisId axisIndex,
     const Geom::Point &origo,
     const Interval &interval,
     const Geom::AffineTransform &tr,
-    double weight) const
+    double weight,
+    LabelLayout *layout) const
 {
 	if (weight == 0) return;
 	auto orientation = Gen::orientation(axisIndex);
@@ -543,7 +590,7 @@ void DrawAxes::drawDimensionLabel(Gen::AxisId axisIndex,
 	const auto &labelStyle = rootStyle.plot.getAxis(axisIndex).label;
 
 	auto drawLabel = OrientedLabel{{ctx()}};
-	labelStyle.position->visit(
+	auto drawAt =
 	    [this,
 	        &tr,
 	        &axisIndex,
@@ -556,68 +603,99 @@ void DrawAxes::drawDimensionLabel(Gen::AxisId axisIndex,
 	        normal = Geom::Point::Ident(!orientation),
 	        &dimInfo = *interval.label,
 	        &weight](::Anim::InterpolateIndex index,
-	        const auto &position)
-	    {
-		    if (labelStyle.position->interpolates()
-		        && !dimInfo.presentAt(index))
-			    return;
-
-		    Geom::Point refPos;
-
-		    switch (position.value) {
-			    using Pos = Styles::AxisLabel::Position;
-		    case Pos::max_edge: refPos = normal; break;
-		    case Pos::axis: refPos = origo.comp(!orientation); break;
-		    default:
-		    case Pos::min_edge: refPos = Geom::Point(); break;
-		    }
-
-		    auto relCenter = refPos + ident * interval.range.middle();
-
-		    auto under =
-		        labelStyle.position->interpolates()
-		            ? labelStyle.side->get_or_first(index).value
-		                  == Styles::AxisLabel::Side::negative
-		            : labelStyle.side->factor(
-		                  Styles::AxisLabel::Side::negative);
-
-		    auto draw = [&,
-		                    posDir = coordSys
-		                                 .convertDirectionAt(
-		                                     tr(Geom::Line{relCenter,
-		                                         relCenter + normal}))
-		                                 .extend(1 - 2 * under)](
-		                    const ::Anim::Weighted<bool> &str,
-		                    double plusWeight = 1.0)
-		    {
-			    if (!str.value) return;
-			    drawLabel.draw(canvas,
+	        const auto &position,
+	        LabelLayout *layout)
+	{
+		if (labelStyle.position->interpolates()
+		    && !dimInfo.presentAt(index))
+			return true;
+
+		Geom::Point refPos;
+
+		switch (position.value) {
+			using Pos = Styles::AxisLabel::Position;
+		case Pos::max_edge: refPos = normal; break;
+		case Pos::axis: refPos = origo.comp(!orientation); break;
+		default:
+		case Pos::min_edge: refPos = Geom::Point(); break;
+		}
+
+		auto relCenter = refPos + ident * interval.range.middle();
+
+		auto under =
+		    labelStyle.position->interpolates()
+		        ? labelStyle.side->get_or_first(index).value
+		              == Styles::AxisLabel::Side::negative
+		        : labelStyle.side->factor(
+		              Styles::AxisLabel::Side::negative);
+
+		auto draw = [&,
+		                posDir =
+		                    coordSys
+		                        .convertDirectionAt(tr(Geom::Line{
+		                            relCenter,
+		                            relCenter + normal}))
+		                        .extend(1 - 2 * under)](
+		                const ::Anim::Weighted<bool> &str,
+		                double plusWeight,
+		                LabelLayout *layout)
+		{
+			if (!str.value) return true;
+			auto alpha =
+			    Math::FuzzyBool::And(weight, str.weight, plusWeight);
+			return drawLabel.draw(canvas,
+			    dimInfo.index.value,
+			    posDir,
+			    labelStyle,
+			    0,
+			    Gfx::ColorTransform::Opacity(alpha),
+			    *rootEvents.draw.plot.axis.label,
+			    Events::Targets::dimAxisLabel(
+			        renderedChart.getTargetPool(),
+			        dimInfo.index.column,
 			        dimInfo.index.value,
-			        posDir,
-			        labelStyle,
-			        0,
-			        Gfx::ColorTransform::Opacity(
-			            Math::FuzzyBool::And(weight,
-			                str.weight,
-			                plusWeight)),
-			        *rootEvents.draw.plot.axis.label,
-			        Events::Targets::dimAxisLabel(
-			            dimInfo.index.column,
-			            dimInfo.index.value,
-			            axisIndex));
-		    };
-
-		    if (dimInfo.presented.interpolates()
-		        && !labelStyle.position->interpolates()) {
-			    draw(dimInfo.presented.get_or_first(::Anim::first));
-			    draw(dimInfo.presented.get_or_first(::Anim::second));
-		    }
-		    else
-			    draw(dimInfo.presented.get_or_first(index),
-			        !labelStyle.position->interpolates()
-			            ? 1.0
-			            : position.weight);
-	    });
+			        axisIndex),
+			    LabelLayout::forAlpha(layout, alpha));
+		};
+
+		if (dimInfo.presented.interpolates()
+		    && !labelStyle.position->interpolates()) {
+			const auto &first =
+			    dimInfo.presented.get_or_first(::Anim::first);
+			const auto &second =
+			    dimInfo.presented.get_or_first(::Anim::second);
+			// the fading out and in labels of the interval share
+			// their place, only the dominant one is laid out
+			const auto &[dominant, other] =
+			    second.weight > first.weight
+			        ? std::pair{&second, &first}
+			        : std::pair{&first, &second};
+			return draw(*dominant, 1.0, layout)
+			    && draw(*other, 1.0, nullptr);
+		}
+		return draw(dimInfo.presented.get_or_first(index),
+		    !labelStyle.position->interpolates() ? 1.0
+		                                          : position.weight,
+		    layout);
+	};
+
+	const auto &position = *labelStyle.position;
+	if (!position.interpolates()) {
+		drawAt(::Anim::first,
+		    position.get_or_first(::Anim::first),
+		    layout);
+		return;
+	}
+
+	auto dominant =
+	    position.get_or_first(::Anim::second).weight
+	            > position.get_or_first(::Anim::first).weight
+	        ? ::Anim::second
+	        : ::Anim::first;
+	auto other =
+	    dominant == ::Anim::first ? ::Anim::second : ::Anim::first;
+	if (drawAt(dominant, position.get_or_first(dominant), layout))
+		drawAt(other, position.get_or_first(other), nullptr);
 }
 
-}
\ No newline at end of file
+}
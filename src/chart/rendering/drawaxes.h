@@ -6,6 +6,7 @@
 #include "chart/generator/plot.h" // NOLINT(misc-include-cleaner)
 
 #include "drawingcontext.h"
+#include "labellayout.h"
 
 namespace Vizzu::Draw
 {
@@ -60,10 +61,39 @@ public:
 		std::optional<DimLabel> label{};
 	};
 
+	// measure ticks of an axis, kept between the frames while the
+	// axis range and step are unchanged
+	struct MeasureTicks
+	{
+		struct Key
+		{
+			double enabled{};
+			::Anim::Interpolated<double> step;
+			Math::Range<> range;
+			Geom::Point origo;
+
+			bool operator==(const Key &) const = default;
+		};
+
+		std::optional<Key> key;
+		std::vector<Interval> intervals;
+		std::vector<Separator> separators;
+	};
+
+	// storage of the generated guides, kept in the render cache to
+	// reuse its capacity in the next frame
+	struct Buffers
+	{
+		Refl::EnumArray<Gen::AxisId, std::vector<Interval>> intervals;
+		Refl::EnumArray<Gen::AxisId, std::vector<Separator>>
+		    separators;
+		// interlacing weight steps of an axis, sorted by position
+		std::vector<std::pair<double, double>> interlacingWeights;
+	};
+
 	[[nodiscard]] const DrawAxes &&init() &&;
 
-	Refl::EnumArray<Gen::AxisId, std::vector<Interval>> intervals;
-	Refl::EnumArray<Gen::AxisId, std::vector<Separator>> separators;
+	Buffers &buffers;
 	Refl::EnumArray<Gen::AxisId,
 	    std::ranges::subrange<Gen::SplitAxis::Parts::const_iterator,
 	        Gen::SplitAxis::Parts::const_iterator,
@@ -73,7 +103,7 @@ public:
 	[[nodiscard]] auto getIntervals(Gen::AxisId axisIndex,
 	    const Math::Range<> &filter = {0.0, 1.0}) const
 	{
-		return std::views::filter(intervals[axisIndex],
+		return std::views::filter(buffers.intervals[axisIndex],
 		    [filter](const Interval &interval) -> bool
 		    {
 			    return filter.intersects(interval.range);
@@ -83,7 +113,7 @@ public:
 	[[nodiscard]] auto getSeparators(Gen::AxisId axisIndex,
 	    const Math::Range<> &filter) const
 	{
-		return std::views::filter(separators[axisIndex],
+		return std::views::filter(buffers.separators[axisIndex],
 		    [&filter](const Separator &sep) -> bool
 		    {
 			    return filter.includes(sep.position);
@@ -91,6 +121,7 @@ public:
 	}
 
 private:
+	void generateMeasure(Gen::AxisId axisIndex, double measEnabled);
 	void generateMeasure(Gen::AxisId axisIndex,
 	    double stepSize,
 	    double weight);
@@ -115,7 +146,8 @@ private:
 	    const Geom::Point &origo,
 	    const Interval &interval,
 	    const Geom::AffineTransform &tr,
-	    double weight) const;
+	    double weight,
+	    LabelLayout *layout) const;
 };
 
 }
@@ -17,7 +17,7 @@ void DrawBackground::draw(Gfx::ICanvas &canvas,
     const Geom::Rect &rect,
     const Styles::Box &style,
     Util::EventDispatcher::Event &onDraw,
-    std::unique_ptr<Util::EventTarget> &&eventTarget) const
+    EventTargetPtr &&eventTarget) const
 {
 	if (Events::OnRectDrawEvent eventObj(*eventTarget, {rect, false});
 	    !style.borderColor->isTransparent()
@@ -16,7 +16,7 @@ struct DrawBackground : DrawingContext
 	    const Geom::Rect &rect,
 	    const Styles::Box &style,
 	    Util::EventDispatcher::Event &onDraw,
-	    std::unique_ptr<Util::EventTarget> &&eventTarget) const;
+	    EventTargetPtr &&eventTarget) const;
 };
 
 }
@@ -1,5 +1,8 @@
 #include "drawchart.h"
 
+#include <cstddef>
+#include <optional>
+#include <tuple>
 #include <utility>
 
 #include "base/anim/interpolated.h"
@@ -8,77 +11,275 @@
 #include "base/geom/transformedrect.h"
 #include "base/gfx/canvas.h"
 #include "base/gfx/colortransform.h"
+#include "base/gfx/font.h"
+#include "base/gfx/textboundarycache.h"
 #include "base/math/fuzzybool.h"
+#include "base/refl/auto_struct.h"
+#include "base/util/eventdispatcher.h"
+#include "base/util/hash.h"
+#include "base/util/profiler.h"
 #include "chart/main/layout.h"
 #include "painter/painter.h"
 
+#include "drawaxes.h"
 #include "drawbackground.h"
 #include "drawlabel.h"
 #include "drawlegend.h"
 #include "drawmarkerinfo.h"
 #include "drawplot.h"
 #include "logo.h"
+#include "rendercache.h"
 
 namespace Vizzu::Draw
 {
+namespace
+{
+void addValue(Util::Hash &hash, const Geom::Rect &rect)
+{
+	hash.add(rect.pos.x, rect.pos.y, rect.size.x, rect.size.y);
+}
+
+void addValue(Util::Hash &hash, const Gfx::Color &color)
+{
+	hash.add(color.red, color.green, color.blue, color.alpha);
+}
+
+void addValue(Util::Hash &hash, const Gfx::Font &font)
+{
+	hash.add(font.family,
+	    font.size,
+	    static_cast<int>(font.weight),
+	    font.style);
+}
+
+void addValue(Util::Hash &hash, const Gen::Options::Heading &heading)
+{
+	heading.visit(
+	    [&hash](::Anim::InterpolateIndex, const auto &weighted)
+	    {
+		    hash.add(weighted.value, weighted.weight);
+	    });
+}
+
+template <class T> void addValue(Util::Hash &hash, const T &value)
+{
+	hash.add(value);
+}
+
+template <class Events> bool hasListeners(const Events &events)
+{
+	auto res = false;
+	Refl::visit(
+	    [&res](const Util::EventDispatcher::event_ptr &event)
+	    {
+		    res = res || event->hasListeners();
+	    },
+	    events);
+	return res;
+}
+
+template <class Inputs> std::size_t hashOf(const Inputs &inputs)
+{
+	Util::Hash hash;
+	std::apply(
+	    [&hash](const auto &...values)
+	    {
+		    (addValue(hash, values), ...);
+	    },
+	    inputs);
+	return hash.get();
+}
+}
+
+template <class Inputs, class Current, class DrawFn>
+void DrawChart::drawLayer(Gfx::ICanvas &canvas,
+    Layer layer,
+    std::optional<Inputs> *stored,
+    const Current &inputs,
+    const DrawFn &draw) const
+{
+	if (!stored) {
+		draw();
+		return;
+	}
+
+	auto id = static_cast<std::size_t>(layer);
+	auto key = hashOf(inputs);
+	if (*stored != inputs)
+		*stored = inputs;
+	else if (renderedChart.hasLayer(id, key)
+	         && canvas.replayLayer(id, key)) {
+		renderedChart.reuseLayer(id, key);
+		return;
+	}
+
+	canvas.beginLayer(id, key);
+	renderedChart.beginLayer(id, key);
+	draw();
+	renderedChart.endLayer();
+	canvas.endLayer();
+}
+
 void DrawChart::drawBackground(Gfx::ICanvas &canvas,
     const Geom::Rect &bounds) const
 {
-	DrawBackground{{ctx()}}.draw(canvas,
+	auto &onDraw = *rootEvents.draw.background;
+
+	drawLayer(canvas,
+	    Layer::background,
+	    cache && !onDraw.hasListeners() ? &cache->layers.background
+	                                    : nullptr,
+	    std::tie(bounds,
+	        *rootStyle.backgroundColor,
+	        *rootStyle.borderColor,
+	        *rootStyle.borderWidth),
+	    [&]
+	    {
+		    DrawBackground{{ctx()}}.draw(canvas,
+		        bounds,
+		        rootStyle,
+		        onDraw,
+		        Events::Targets::root(renderedChart.getTargetPool()));
+	    });
+}
+
+DrawChart::LayerInputs::Plot DrawChart::plotInputs(
+    const Geom::Rect &bounds) const
+{
+	return {plot.get(),
+	    cache->plotGeneration,
 	    bounds,
-	    rootStyle,
-	    *rootEvents.draw.background,
-	    Events::Targets::root());
+	    Gfx::ICanvas::textBoundaryCache().getGeneration()};
 }
 
 void DrawChart::drawPlot(Gfx::ICanvas &canvas,
     Painter &painter,
     const Geom::Rect &plotRect) const
 {
-	DrawPlot{{ctx()}}.draw(canvas, painter, plotRect);
+	const DrawPlot drawPlot{{ctx()}};
+
+	std::optional<DrawAxes::Buffers> frameAxes;
+	std::optional<DrawAxes> axes;
+	auto getAxes = [&]() -> const DrawAxes &
+	{
+		if (!axes)
+			axes.emplace(DrawAxes{{ctx()},
+			    canvas,
+			    painter,
+			    cache ? cache->axes : frameAxes.emplace(),
+			    {}}.init());
+		return *axes;
+	};
+
+	auto *layers = cache && !hasListeners(rootEvents.draw.plot)
+	                 ? &cache->layers
+	                 : nullptr;
+	auto inputs = layers ? plotInputs(plotRect) : LayerInputs::Plot{};
+
+	drawLayer(canvas,
+	    Layer::axes,
+	    layers ? &layers->axes : nullptr,
+	    inputs,
+	    [&]
+	    {
+		    drawPlot.drawBackground(canvas,
+		        painter,
+		        plotRect,
+		        getAxes());
+	    });
+
+	drawLayer(canvas,
+	    Layer::markers,
+	    layers ? &layers->markers : nullptr,
+	    inputs,
+	    [&]
+	    {
+		    drawPlot.drawMarkers(canvas, painter);
+	    });
+
+	drawLayer(canvas,
+	    Layer::axisLabels,
+	    layers ? &layers->axisLabels : nullptr,
+	    inputs,
+	    [&]
+	    {
+		    getAxes().drawLabels();
+	    });
 }
 
 void DrawChart::drawLegend(Gfx::ICanvas &canvas,
     const Geom::Rect &bounds) const
 {
-	auto &&legendObj = DrawLegend{{ctx()}};
+	drawLayer(canvas,
+	    Layer::legend,
+	    cache && !hasListeners(rootEvents.draw.legend)
+	        ? &cache->layers.legend
+	        : nullptr,
+	    cache ? plotInputs(bounds) : LayerInputs::Plot{},
+	    [&]
+	    {
+		    auto &&legendObj = DrawLegend{{ctx()}};
 
-	for (auto &&legOpt = getOptions().legend;
-	     const auto &legend : plot->axises.leftLegend)
-		if (legend)
-			legendObj.draw(canvas,
-			    bounds,
-			    legend->type,
-			    legOpt.factor(legend->type),
-			    legend->calc);
+		    for (auto &&legOpt = getOptions().legend;
+		         const auto &legend : plot->axises.leftLegend)
+			    if (legend)
+				    legendObj.draw(canvas,
+				        bounds,
+				        legend->type,
+				        legOpt.factor(legend->type),
+				        legend->calc);
+	    });
 }
 
 template <auto targetGetter, class MemberGetter>
 void DrawChart::drawHeading(Gfx::ICanvas &canvas,
+    Layer layer,
     const Layout &layout,
     const MemberGetter &&getter) const
 {
-	getter(getOptions())
-	    .visit(
-	        [&layout = getter(layout),
-	            &style = getter(rootStyle),
-	            &event = *getter(rootEvents.draw),
-	            &canvas,
-	            this](::Anim::InterpolateIndex, const auto &weighted)
-	        {
-		        if (weighted.value.has_value()) {
-			        DrawLabel{{ctx()}}.draw(canvas,
-			            Geom::TransformedRect::fromRect(layout),
-			            *weighted.value,
-			            style,
-			            event,
-			            targetGetter(*weighted.value),
-			            {.colorTransform =
-			                    Gfx::ColorTransform::Opacity(
-			                        Math::FuzzyBool::more(
-			                            weighted.weight))});
-		        }
-	        });
+	const auto &heading = getter(getOptions());
+	const auto &rect = getter(layout);
+	const auto &style = getter(rootStyle);
+	auto &event = *getter(rootEvents.draw);
+
+	auto font = Gfx::Font{style};
+	auto content =
+	    style.contentRect({{}, rect.size}, font.size, false);
+	auto align = style.textAlign->template combine<double>();
+	auto generation =
+	    Gfx::ICanvas::textBoundaryCache().getGeneration();
+
+	drawLayer(canvas,
+	    layer,
+	    cache && !event.hasListeners() ? &getter(cache->layers)
+	                                   : nullptr,
+	    std::tie(rect,
+	        content,
+	        *style.color,
+	        font,
+	        align,
+	        generation,
+	        heading),
+	    [&]
+	    {
+		    heading.visit(
+		        [&](::Anim::InterpolateIndex, const auto &weighted)
+		        {
+			        if (weighted.value.has_value()) {
+				        DrawLabel{{ctx()}}.draw(canvas,
+				            Geom::TransformedRect::fromRect(rect),
+				            *weighted.value,
+				            style,
+				            event,
+				            targetGetter(renderedChart.getTargetPool(),
+				                *weighted.value),
+				            {.colorTransform =
+				                    Gfx::ColorTransform::Opacity(
+				                        Math::FuzzyBool::more(
+				                            weighted.weight))});
+			        }
+		        });
+	    });
 }
 
 void DrawChart::drawMarkerInfo(Gfx::ICanvas &canvas,
@@ -90,21 +291,35 @@ void DrawChart::drawMarkerInfo(Gfx::ICanvas &canvas,
 void DrawChart::drawLogo(Gfx::ICanvas &canvas,
     const Geom::Rect &bounds) const
 {
-	if (auto logoElement = Events::Targets::logo();
-	    rootEvents.draw.logo->invoke(
-	        Events::OnRectDrawEvent(*logoElement, {bounds, false}))) {
+	auto &onDraw = *rootEvents.draw.logo;
 
-		Logo(canvas).draw(bounds.pos,
-		    bounds.width(),
-		    *rootStyle.logo.filter);
+	drawLayer(canvas,
+	    Layer::logo,
+	    cache && !onDraw.hasListeners() ? &cache->layers.logo
+	                                    : nullptr,
+	    std::tie(bounds, *rootStyle.logo.filter),
+	    [&]
+	    {
+		    if (auto logoElement =
+		            Events::Targets::logo(renderedChart.getTargetPool());
+		        onDraw.invoke(Events::OnRectDrawEvent(*logoElement,
+		            {bounds, false}))) {
 
-		renderedChart.emplace(Geom::TransformedRect::fromRect(bounds),
-		    std::move(logoElement));
-	}
+			    Logo(canvas).draw(bounds.pos,
+			        bounds.width(),
+			        *rootStyle.logo.filter);
+
+			    renderedChart.emplace(
+			        Geom::TransformedRect::fromRect(bounds),
+			        std::move(logoElement));
+		    }
+	    });
 }
 
 void DrawChart::draw(Gfx::ICanvas &canvas, const Layout &layout) const
 {
+	const Util::Profiler::Scope profile{"DrawChart::draw"};
+
 	Painter &painter = *static_cast<Painter *>(canvas.getPainter());
 	painter.setCoordSys(coordSys);
 
@@ -118,6 +333,7 @@ void DrawChart::draw(Gfx::ICanvas &canvas, const Layout &layout) const
 		drawLegend(canvas, layout.legend);
 
 		drawHeading<&Events::Targets::chartTitle>(canvas,
+		    Layer::title,
 		    layout,
 		    [](auto &obj) -> auto &
 		    {
@@ -125,6 +341,7 @@ void DrawChart::draw(Gfx::ICanvas &canvas, const Layout &layout) const
 		    });
 
 		drawHeading<&Events::Targets::chartSubtitle>(canvas,
+		    Layer::subtitle,
 		    layout,
 		    [](auto &obj) -> auto &
 		    {
@@ -132,6 +349,7 @@ void DrawChart::draw(Gfx::ICanvas &canvas, const Layout &layout) const
 		    });
 
 		drawHeading<&Events::Targets::chartCaption>(canvas,
+		    Layer::caption,
 		    layout,
 		    [](auto &obj) -> auto &
 		    {
@@ -2,6 +2,17 @@
 #ifndef VIZZU_DRAWCHART_H
 #define VIZZU_DRAWCHART_H
 
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <tuple>
+
+#include "base/geom/rect.h"
+#include "base/gfx/color.h"
+#include "base/gfx/colortransform.h"
+#include "base/gfx/font.h"
+#include "chart/options/options.h"
+
 #include "drawingcontext.h"
 
 namespace Vizzu::Draw
@@ -9,9 +20,73 @@ namespace Vizzu::Draw
 
 class DrawChart : public DrawingContext
 {
+public:
+	// Inputs the cached layers were last drawn from. A layer is
+	// replayed only if its inputs compare equal, the hash of them
+	// just identifies the layer in the canvas.
+	struct LayerInputs
+	{
+		using Heading = std::tuple<Geom::Rect,
+		    Geom::Rect,
+		    Gfx::Color,
+		    Gfx::Font,
+		    double,
+		    std::size_t,
+		    Gen::Options::Heading>;
+
+		std::optional<
+		    std::tuple<Geom::Rect, Gfx::Color, Gfx::Color, double>>
+		    background;
+		std::optional<Heading> title;
+		std::optional<Heading> subtitle;
+		std::optional<Heading> caption;
+		std::optional<std::tuple<Geom::Rect, Gfx::ColorTransform>>
+		    logo;
+
+		// plot, plot generation, bounds and text measurement
+		// generation of the layers drawn from the plot
+		using Plot = std::tuple<const Gen::Plot *,
+		    std::size_t,
+		    Geom::Rect,
+		    std::size_t>;
+
+		std::optional<Plot> axes;
+		std::optional<Plot> markers;
+		std::optional<Plot> axisLabels;
+		std::optional<Plot> legend;
+	};
+
+	void draw(Gfx::ICanvas &canvas, const Layout &layout) const;
+
+private:
+	// the layers drawn from the plot are replayed while the plot and
+	// its animation position are unchanged, the tooltip is redrawn
+	// on every frame
+	enum class Layer : std::uint8_t {
+		background,
+		title,
+		subtitle,
+		caption,
+		logo,
+		axes,
+		markers,
+		axisLabels,
+		legend
+	};
+
+	template <class Inputs, class Current, class DrawFn>
+	void drawLayer(Gfx::ICanvas &canvas,
+	    Layer layer,
+	    std::optional<Inputs> *stored,
+	    const Current &inputs,
+	    const DrawFn &draw) const;
+
 	void drawBackground(Gfx::ICanvas &canvas,
 	    const Geom::Rect &bounds) const;
 
+	[[nodiscard]] LayerInputs::Plot plotInputs(
+	    const Geom::Rect &bounds) const;
+
 	void drawPlot(Gfx::ICanvas &canvas,
 	    Painter &painter,
 	    const Geom::Rect &plotRect) const;
@@ -21,6 +96,7 @@ class DrawChart : public DrawingContext
 
 	template <auto targetGetter, class MemberGetter>
 	void drawHeading(Gfx::ICanvas &canvas,
+	    Layer layer,
 	    const Layout &layout,
 	    const MemberGetter &&getter) const;
 
@@ -29,9 +105,6 @@ class DrawChart : public DrawingContext
 
 	void drawLogo(Gfx::ICanvas &canvas,
 	    const Geom::Rect &bounds) const;
-
-public:
-	void draw(Gfx::ICanvas &canvas, const Layout &layout) const;
 };
 
 }
@@ -55,7 +55,9 @@ void DrawGuides::drawGuide(Gen::AxisId axisId,
 	auto line =
 	    tr(Geom::Line{Geom::Point::Coord(o, val, otherFilter.min),
 	        Geom::Point::Coord(o, val, otherFilter.max)});
-	if (auto &&eventTarget = Events::Targets::axisGuide(axisId);
+	if (auto &&eventTarget = Events::Targets::axisGuide(
+	        parent.renderedChart.getTargetPool(),
+	        axisId);
 	    parent.rootEvents.draw.plot.axis.guide->invoke(
 	        Events::OnLineDrawEvent(*eventTarget, {line, true}))) {
 		parent.painter.drawLine(line);
@@ -14,6 +14,8 @@
 namespace Vizzu::Draw
 {
 
+struct RenderCache;
+
 struct DrawingContext
 {
 	const Gen::PlotPtr &plot;
@@ -22,6 +24,7 @@ struct DrawingContext
 	const CoordinateSystem &coordSys;
 	const Styles::Chart &rootStyle;
 	const Events &rootEvents;
+	RenderCache *cache{};
 
 	[[nodiscard]] const Gen::Options &getOptions() const
 	{
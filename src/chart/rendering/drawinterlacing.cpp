@@ -6,9 +6,11 @@
 #include <compare>
 #include <cstddef>
 #include <iterator>
-#include <map>
 #include <memory>
+#include <optional>
+#include <string>
 #include <utility>
+#include <vector>
 
 #include "base/anim/interpolated.h"
 #include "base/geom/affinetransform.h"
@@ -23,9 +25,12 @@
 #include "base/type/booliter.h"
 #include "chart/generator/plot.h" // NOLINT(misc-include-cleaner)
 #include "chart/main/events.h"
+#include "chart/main/style.h"
 #include "chart/options/channel.h"
 
+#include "labellayout.h"
 #include "orientedlabel.h"
+#include "rendercache.h"
 #include "renderedchart.h"
 
 namespace Vizzu::Draw
@@ -44,7 +49,7 @@ void DrawInterlacing::drawGeometries(Gen::AxisId axisIndex,
 	    || Math::Floating::is_zero(otherFilter.size()))
 		return;
 
-	auto otherWeights =
+	const auto &otherWeights =
 	    getInterlacingWeights(!axisIndex, otherFilter);
 	auto &&otherInterlacingColor =
 	    *parent.rootStyle.plot.getAxis(!axisIndex).interlacing.color;
@@ -162,6 +167,10 @@ void DrawInterlacing::drawTexts(Gen::AxisId axisIndex,
 			}
 		}
 
+	std::optional<LabelLayout> layout;
+	if (axisStyle.label.overlap == Styles::Overlap::hidden)
+		layout.emplace();
+
 	for (const auto &sep : parent.getSeparators(axisIndex, filter)) {
 		auto tickPos =
 		    Geom::Point::Coord(orientation, origo, sep.position);
@@ -177,7 +186,8 @@ void DrawInterlacing::drawTexts(Gen::AxisId axisIndex,
 			    axis.unit,
 			    Math::FuzzyBool::And<double>(w,
 			        sep.weight,
-			        guides.labels));
+			        guides.labels),
+			    layout ? &*layout : nullptr);
 
 		if (needTick)
 			drawSticks(tickLength,
@@ -201,7 +211,9 @@ void DrawInterlacing::drawInterlacing(Gen::AxisId axisIndex,
 	canvas.setLineWidth(0);
 	canvas.setBrushColor(interlacingColor);
 	if (auto &&eventTarget =
-	        Events::Targets::axisInterlacing(axisIndex);
+	        Events::Targets::axisInterlacing(
+	            parent.renderedChart.getTargetPool(),
+	            axisIndex);
 	    parent.rootEvents.draw.plot.axis.interlacing->invoke(
 	        Events::OnRectDrawEvent(*eventTarget, {rect, true}))) {
 		parent.painter.drawPolygon(rect.points());
@@ -218,7 +230,8 @@ void DrawInterlacing::drawDataLabel(
     const Geom::AffineTransform &tr,
     double value,
     const ::Anim::String &unit,
-    double alpha) const
+    double alpha,
+    LabelLayout *layout) const
 {
 	auto orientation = !Gen::orientation(axisIndex);
 	const auto &labelStyle =
@@ -226,13 +239,25 @@ void DrawInterlacing::drawDataLabel(
 
 	auto drawLabel = OrientedLabel{{parent.ctx()}};
 	auto interpolates =
-	    labelStyle.position->maxIndex() || unit.maxIndex();
+	    labelStyle.position->maxIndex() != ::Anim::first
+	    || unit.maxIndex() != ::Anim::first;
 
 	auto &&normal = Geom::Point::Ident(orientation);
-	for (auto &&index : Type::Bools{interpolates}) {
+	auto labelAlpha = [&](::Anim::InterpolateIndex index)
+	{
 		if (labelStyle.position->interpolates()
 		    && !axisEnabled.get_or_first(index).value)
-			continue;
+			return 0.0;
+		return Math::FuzzyBool::And(alpha,
+		    labelStyle.position->get_or_first(index).weight,
+		    unit.get_or_first(index).weight);
+	};
+	auto drawAt = [&](::Anim::InterpolateIndex index,
+	                  LabelLayout *layout)
+	{
+		if (labelStyle.position->interpolates()
+		    && !axisEnabled.get_or_first(index).value)
+			return true;
 		auto &&position = labelStyle.position->get_or_first(index);
 
 		Geom::Point refPos = tickPos;
@@ -256,22 +281,52 @@ void DrawInterlacing::drawDataLabel(
 		                    .extend(1 - 2 * under);
 
 		auto &&wUnit = unit.get_or_first(index);
-		auto str = Text::SmartString::fromPhysicalValue(value,
-		    *labelStyle.numberFormat,
-		    static_cast<size_t>(*labelStyle.maxFractionDigits),
-		    *labelStyle.numberScale,
-		    wUnit.value);
-		drawLabel.draw(parent.canvas,
+		auto maxFractionDigits =
+		    static_cast<size_t>(*labelStyle.maxFractionDigits);
+		std::string uncached;
+		if (!parent.cache)
+			uncached = Text::SmartString::fromPhysicalValue(value,
+			    *labelStyle.numberFormat,
+			    maxFractionDigits,
+			    *labelStyle.numberScale,
+			    wUnit.value);
+		const auto &str =
+		    parent.cache
+		        ? parent.cache->tickLabels[axisIndex].get(value,
+		              *labelStyle.numberFormat,
+		              maxFractionDigits,
+		              *labelStyle.numberScale,
+		              wUnit.value)
+		        : uncached;
+		auto labelAlphaAt = labelAlpha(index);
+		return drawLabel.draw(parent.canvas,
 		    str,
 		    posDir,
 		    labelStyle,
 		    0,
-		    Gfx::ColorTransform::Opacity(Math::FuzzyBool::And(alpha,
-		        position.weight,
-		        wUnit.weight)),
+		    Gfx::ColorTransform::Opacity(labelAlphaAt),
 		    *parent.rootEvents.draw.plot.axis.label,
-		    Events::Targets::measAxisLabel(str, axisIndex));
+		    Events::Targets::measAxisLabel(
+		        parent.renderedChart.getTargetPool(),
+		        str,
+		        axisIndex),
+		    LabelLayout::forAlpha(layout, labelAlphaAt));
+	};
+
+	if (!interpolates) {
+		drawAt(::Anim::first, layout);
+		return;
 	}
+
+	// both variants label the same tick, only the dominant one is
+	// laid out
+	auto dominant =
+	    labelAlpha(::Anim::second) > labelAlpha(::Anim::first)
+	        ? ::Anim::second
+	        : ::Anim::first;
+	auto other =
+	    dominant == ::Anim::first ? ::Anim::second : ::Anim::first;
+	if (drawAt(dominant, layout)) drawAt(other, nullptr);
 }
 
 void DrawInterlacing::drawSticks(double tickLength,
@@ -309,7 +364,9 @@ void DrawInterlacing::drawSticks(double tickLength,
 		    }
 	    });
 
-	if (auto &&eventTarget = Events::Targets::axisTick(axisIndex);
+	if (auto &&eventTarget = Events::Targets::axisTick(
+	        parent.renderedChart.getTargetPool(),
+	        axisIndex);
 	    parent.rootEvents.draw.plot.axis.tick->invoke(
 	        Events::OnLineDrawEvent(*eventTarget,
 	            {tickLine, false}))) {
@@ -321,12 +378,15 @@ void DrawInterlacing::drawSticks(double tickLength,
 	canvas.restore();
 }
 
-std::map<double, double> DrawInterlacing::getInterlacingWeights(
-    Gen::AxisId axisIndex,
+const std::vector<std::pair<double, double>> &
+DrawInterlacing::getInterlacingWeights(Gen::AxisId axisIndex,
     const Math::Range<> &filter) const
 {
-	std::map<double, double> weights{{filter.min, 0.0},
-	    {filter.max, 0.0}};
+	auto &weights = parent.buffers.interlacingWeights;
+	weights.clear();
+	weights.emplace_back(filter.min, 0.0);
+	if (filter.max != filter.min)
+		weights.emplace_back(filter.max, 0.0);
 
 	auto &&guides = parent.plot->guides.at(axisIndex);
 	auto &&axisStyle = parent.rootStyle.plot.getAxis(axisIndex);
@@ -341,15 +401,25 @@ std::map<double, double> DrawInterlacing::getInterlacingWeights(
 		auto min = std::max(interval.range.min, filter.min);
 		auto max = std::min(interval.range.max, filter.max);
 
-		auto mprev = std::prev(weights.upper_bound(min));
-		auto mnext = weights.lower_bound(max);
-
-		if (mprev->first < min)
-			mprev = weights.try_emplace(mprev, min, mprev->second);
-		if (mnext->first > max)
-			mnext = weights.try_emplace(mnext,
-			    max,
-			    std::prev(mnext)->second);
+		auto mprev = std::prev(std::ranges::upper_bound(weights,
+		    min,
+		    {},
+		    &std::pair<double, double>::first));
+		if (mprev->first < min) {
+			auto value = mprev->second;
+			mprev = weights.emplace(std::next(mprev), min, value);
+		}
+		auto first = mprev - weights.begin();
+
+		auto mnext = std::ranges::lower_bound(weights,
+		    max,
+		    {},
+		    &std::pair<double, double>::first);
+		if (mnext->first > max) {
+			auto value = std::prev(mnext)->second;
+			mnext = weights.emplace(mnext, max, value);
+		}
+		mprev = weights.begin() + first;
 
 		while (mprev != mnext)
 			mprev++->second +=
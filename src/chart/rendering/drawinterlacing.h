@@ -1,8 +1,12 @@
 #ifndef DRAWINTERLACING_H
 #define DRAWINTERLACING_H
 
+#include <utility>
+#include <vector>
+
 #include "drawaxes.h"
 #include "drawingcontext.h"
+#include "labellayout.h"
 
 namespace Vizzu::Draw
 {
@@ -34,7 +38,8 @@ private:
 	    const Geom::AffineTransform &tr,
 	    double value,
 	    const ::Anim::String &unit,
-	    double alpha) const;
+	    double alpha,
+	    LabelLayout *layout) const;
 
 	void drawSticks(double tickLength,
 	    const Gfx::Color &tickColor,
@@ -42,7 +47,8 @@ private:
 	    const Geom::Point &tickPos,
 	    const Geom::AffineTransform &tr) const;
 
-	[[nodiscard]] std::map<double, double> getInterlacingWeights(
+	[[nodiscard]] const std::vector<std::pair<double, double>> &
+	getInterlacingWeights(
 	    Gen::AxisId axisIndex,
 	    const Math::Range<> &filter) const;
 
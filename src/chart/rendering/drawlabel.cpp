@@ -22,7 +22,7 @@ void DrawLabel::draw(Gfx::ICanvas &canvas,
     const std::string &text,
     const Styles::Label &style,
     Util::EventDispatcher::Event &onDraw,
-    std::unique_ptr<Util::EventTarget> eventTarget,
+    EventTargetPtr eventTarget,
     const Options &options) const
 {
 	auto relativeRect = Geom::Rect{{}, fullRect.size};
@@ -56,7 +56,8 @@ void DrawLabel::draw(Gfx::ICanvas &canvas,
 	else
 		canvas.setBrushColor(textColor);
 
-	if (onDraw.invoke(Events::OnTextDrawEvent{*eventTarget,
+	if (!onDraw.hasListeners()
+	    || onDraw.invoke(Events::OnTextDrawEvent{*eventTarget,
 	        copyRect,
 	        paddedRect,
 	        alignConstant,
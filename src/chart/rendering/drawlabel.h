@@ -28,7 +28,7 @@ public:
 	    const std::string &text,
 	    const Styles::Label &style,
 	    Util::EventDispatcher::Event &onDraw,
-	    std::unique_ptr<Util::EventTarget> eventTarget,
+	    EventTargetPtr eventTarget,
 	    const Options &options) const;
 
 private:
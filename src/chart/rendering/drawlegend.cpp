@@ -5,6 +5,7 @@
 #include <cstddef>
 #include <cstdint>
 #include <functional>
+#include <optional>
 #include <string>
 #include <utility>
 
@@ -29,6 +30,7 @@
 #include "chart/rendering/colorbuilder.h"
 #include "chart/rendering/drawbackground.h"
 #include "chart/rendering/drawlabel.h"
+#include "chart/rendering/rendercache.h"
 #include "dataframe/old/types.h"
 
 namespace Vizzu::Draw
@@ -55,7 +57,7 @@ void DrawLegend::draw(Gfx::ICanvas &canvas,
 	    markerWindowRect
 	    + Geom::Rect{{0, -fadeHeight}, {0, 2 * fadeHeight}};
 
-	auto fadeElementPercent = fadeHeight / markerWindowRect.height();
+	std::optional<Gfx::LinearGradient> frameFade;
 
 	auto &&info = Info{.canvas = canvas,
 	    .titleRect = titleRect,
@@ -67,13 +69,8 @@ void DrawLegend::draw(Gfx::ICanvas &canvas,
 	    .axis = axis,
 	    .properties = {.channel = channelType},
 	    .fadeBarGradient = {markerWindowRect.leftSide(),
-	        {.line = {},
-	            .colors = {{
-	                {0.0, {}},
-	                {fadeElementPercent, {}},
-	                {1.0 - fadeElementPercent, {}},
-	                {1.0, {}},
-	            }}}}};
+	        fadeHeight / markerWindowRect.height(),
+	        cache ? cache->legendFade : frameFade.emplace()}};
 
 	auto &&range = markersLegendRange(info);
 	info.properties.scrollHeight = range.size();
@@ -87,7 +84,8 @@ void DrawLegend::draw(Gfx::ICanvas &canvas,
 	    legendLayout,
 	    style,
 	    *events.background,
-	    Events::Targets::legend(info.properties));
+	    Events::Targets::legend(renderedChart.getTargetPool(),
+	        info.properties));
 
 	canvas.save();
 
@@ -112,7 +110,11 @@ const Gfx::LinearGradient &DrawLegend::FadeBarGradient::operator()(
     const Gfx::Color &color,
     const Geom::AffineTransform &transform)
 {
-	for (auto &stop : gradient.colors.stops) stop.value = color;
+	// assigned in place to reuse the capacity of the stops
+	gradient.colors.stops.assign({{0.0, color},
+	    {fadeElementPercent, color},
+	    {1.0 - fadeElementPercent, color},
+	    {1.0, color}});
 
 	gradient.colors.stops.front().value.alpha = 0.0;
 	gradient.colors.stops.back().value.alpha = 0.0;
@@ -140,7 +142,9 @@ void DrawLegend::drawTitle(const Info &info) const
 		        title.value,
 		        style.title,
 		        *events.title,
-		        Events::Targets::legendTitle(title.value,
+		        Events::Targets::legendTitle(
+		            renderedChart.getTargetPool(),
+		            title.value,
 		            info.properties),
 		        {.colorTransform = Gfx::ColorTransform::Opacity(
 		             Math::FuzzyBool::And(title.weight,
@@ -194,7 +198,8 @@ void DrawLegend::drawDimension(Info &info) const
 		    sindex.value,
 		    style.label,
 		    *events.label,
-		    Events::Targets::dimLegendLabel(sindex.column,
+		    Events::Targets::dimLegendLabel(renderedChart.getTargetPool(),
+		        sindex.column,
 		        sindex.value,
 		        info.properties),
 		    {.colorTransform = Gfx::ColorTransform::Opacity(alpha),
@@ -251,7 +256,8 @@ void DrawLegend::drawMarker(Info &info,
 	info.canvas.setLineWidth(0);
 
 	if (auto &&markerElement{
-	        Events::Targets::legendMarker(sindex.column,
+	        Events::Targets::legendMarker(renderedChart.getTargetPool(),
+	            sindex.column,
 	            sindex.value,
 	            info.properties)};
 	    events.marker->invoke(
@@ -306,7 +312,9 @@ void DrawLegend::extremaLabel(const Info &info,
 	    text,
 	    style.label,
 	    *events.label,
-	    Events::Targets::measLegendLabel(text, info.properties),
+	    Events::Targets::measLegendLabel(renderedChart.getTargetPool(),
+	        text,
+	        info.properties),
 	    {.colorTransform = Gfx::ColorTransform::Opacity(
 	         Math::FuzzyBool::And(info.measureWeight, plusWeight))});
 }
@@ -359,7 +367,9 @@ void DrawLegend::colorBar(const Info &info,
 	info.canvas.setLineColor(Gfx::Color::Transparent());
 	info.canvas.setLineWidth(0);
 
-	auto barElement = Events::Targets::legendBar(info.properties);
+	auto barElement =
+	    Events::Targets::legendBar(renderedChart.getTargetPool(),
+	        info.properties);
 
 	if (events.bar->invoke(
 	        Events::OnRectDrawEvent(*barElement, {rect, false}))) {
@@ -389,7 +399,9 @@ void DrawLegend::lightnessBar(const Info &info,
 	info.canvas.setLineColor(Gfx::Color::Transparent());
 	info.canvas.setLineWidth(0);
 
-	auto barElement = Events::Targets::legendBar(info.properties);
+	auto barElement =
+	    Events::Targets::legendBar(renderedChart.getTargetPool(),
+	        info.properties);
 
 	if (events.bar->invoke(
 	        Events::OnRectDrawEvent(*barElement, {rect, false}))) {
@@ -410,7 +422,9 @@ void DrawLegend::sizeBar(const Info &info,
 	    Gfx::Color::Gray(0.8) * info.measureWeight);
 	info.canvas.setLineWidth(0);
 
-	auto barElement = Events::Targets::legendBar(info.properties);
+	auto barElement =
+	    Events::Targets::legendBar(renderedChart.getTargetPool(),
+	        info.properties);
 
 	if (events.bar->invoke(
 	        Events::OnRectDrawEvent(*barElement, {rect, false}))) {
@@ -29,7 +29,8 @@ private:
 	struct FadeBarGradient
 	{
 		Geom::Line origLine;
-		Gfx::LinearGradient gradient;
+		double fadeElementPercent{};
+		Gfx::LinearGradient &gradient;
 
 		[[nodiscard]] const Gfx::LinearGradient &operator()(
 		    const Gfx::Color &,
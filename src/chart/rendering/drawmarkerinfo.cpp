@@ -1,5 +1,7 @@
 #include "drawmarkerinfo.h"
 
+#include <algorithm>
+#include <memory>
 #include <utility>
 
 #include "base/anim/interpolated.h"
@@ -8,22 +10,64 @@
 #include "base/gfx/color.h"
 #include "base/gfx/draw/infobubble.h"
 #include "base/gfx/font.h"
+#include "base/gfx/textboundarycache.h"
 #include "chart/generator/marker.h"
 #include "chart/main/style.h"
 #include "chart/rendering/markers/abstractmarker.h"
 
+#include "rendercache.h"
+
 namespace Vizzu::Draw
 {
 
+std::shared_ptr<Gfx::Draw::TextBox> &
+DrawMarkerInfo::TextCache::get(Id id, Key &&key)
+{
+	auto &entries = texts[id];
+	auto it = std::ranges::find(entries,
+	    key,
+	    &std::pair<Key, std::shared_ptr<TextBox>>::first);
+	if (it != entries.end()) return it->second;
+
+	if (entries.size() >= maxPerId) entries.erase(entries.begin());
+	return entries.emplace_back(std::move(key), nullptr).second;
+}
+
+void DrawMarkerInfo::TextCache::retain(
+    const Gen::Plot::MarkersInfo &markersInfo)
+{
+	std::erase_if(texts,
+	    [&markersInfo](const auto &item)
+	    {
+		    return !markersInfo.contains(item.first);
+	    });
+}
+
 DrawMarkerInfo::MarkerDC::MarkerDC(const DrawMarkerInfo &parent,
     Gfx::ICanvas &canvas,
     const Geom::Rect &boundary,
+    Id id,
     Content &content) :
     parent(parent),
     canvas(canvas)
 {
 	loadMarker(content);
-	fillTextBox(content);
+	if (parent.cache) {
+		const auto &style = parent.style;
+		auto &cached = parent.cache->markerInfoTexts.get(id,
+		    {content.info,
+		        static_cast<Gfx::Font>(style),
+		        style.fontSize->get(),
+		        *style.layout,
+		        *style.color,
+		        *style.borderRadius,
+		        *style.seriesName,
+		        Gfx::ICanvas::textBoundaryCache().getGeneration()});
+		if (!cached) cached = createTextBox(content);
+		text = cached;
+	}
+	else
+		text = createTextBox(content);
 	calculateLayout();
 	if (bubble.pos.x + bubble.size.x > boundary.size.x)
 		calculateLayout(Geom::Point{-1, 0});
@@ -63,8 +107,8 @@ void DrawMarkerInfo::MarkerDC::draw(double weight)
 	    arrow};
 	canvas.save();
 	canvas.setClipRect(bubble);
-	text << bubble.pos;
-	text.draw(canvas, weight);
+	*text << bubble.pos;
+	text->draw(canvas, weight);
 	canvas.restore();
 }
 
@@ -99,8 +143,11 @@ void DrawMarkerInfo::MarkerDC::loadMarker(Content &cnt)
 	labelDir = line.end - line.begin;
 }
 
-void DrawMarkerInfo::MarkerDC::fillTextBox(Content &cnt)
+std::shared_ptr<Gfx::Draw::TextBox>
+DrawMarkerInfo::MarkerDC::createTextBox(Content &cnt) const
 {
+	auto res = std::make_shared<TextBox>();
+	auto &text = *res;
 	auto r = *parent.style.borderRadius * 2;
 	text << TextBox::Padding(r, r, r, r) << TextBox::LineSpacing(1.5);
 	text << Gfx::Color(1, 1, 1, 0);
@@ -143,11 +190,12 @@ void DrawMarkerInfo::MarkerDC::fillTextBox(Content &cnt)
 		if (parent.style.layout == Styles::Tooltip::Layout::multiLine)
 			text << TextBox::NewLine();
 	}
+	return res;
 }
 
 void DrawMarkerInfo::MarkerDC::calculateLayout(Geom::Point hint)
 {
-	bubble.size = text.measure(canvas);
+	bubble.size = text->measure(canvas);
 	if (hint.isNull()) {
 		// orientation: horizontal, right
 		if ((labelDir.x > 0 && labelDir.y > 0
@@ -199,23 +247,34 @@ void DrawMarkerInfo::MarkerDC::calculateLayout(Geom::Point hint)
 void DrawMarkerInfo::draw(Gfx::ICanvas &canvas,
     const Geom::Rect &boundary) const
 {
+	if (cache) cache->markerInfoTexts.retain(plot->getMarkersInfo());
+
 	for (const auto &info : plot->getMarkersInfo()) {
 		auto &&[cnt1, weight1] =
 		    info.second.get_or_first(::Anim::first);
 		if (!info.second.interpolates() && cnt1) {
-			MarkerDC dc(*this, canvas, boundary, cnt1);
+			MarkerDC dc(*this, canvas, boundary, info.first, cnt1);
 			dc.draw(weight1);
 		}
 		else if (info.second.interpolates()) {
 			auto &&[cnt2, weight2] =
 			    info.second.get_or_first(::Anim::second);
 			if (!cnt1 && cnt2)
-				fadeInMarkerInfo(canvas, boundary, cnt2, weight2);
+				fadeInMarkerInfo(canvas,
+				    boundary,
+				    info.first,
+				    cnt2,
+				    weight2);
 			else if (cnt1 && !cnt2)
-				fadeOutMarkerInfo(canvas, boundary, cnt1, weight1);
+				fadeOutMarkerInfo(canvas,
+				    boundary,
+				    info.first,
+				    cnt1,
+				    weight1);
 			else if (cnt1 && cnt2)
 				moveMarkerInfo(canvas,
 				    boundary,
+				    info.first,
 				    cnt1,
 				    weight1,
 				    cnt2,
@@ -226,31 +285,34 @@ void DrawMarkerInfo::draw(Gfx::ICanvas &canvas,
 
 void DrawMarkerInfo::fadeInMarkerInfo(Gfx::ICanvas &canvas,
     const Geom::Rect &boundary,
+    Id id,
     Content &cnt,
     double weight) const
 {
-	MarkerDC dc(*this, canvas, boundary, cnt);
+	MarkerDC dc(*this, canvas, boundary, id, cnt);
 	dc.draw(weight);
 }
 
 void DrawMarkerInfo::fadeOutMarkerInfo(Gfx::ICanvas &canvas,
     const Geom::Rect &boundary,
+    Id id,
     Content &cnt,
     double weight) const
 {
-	MarkerDC dc(*this, canvas, boundary, cnt);
+	MarkerDC dc(*this, canvas, boundary, id, cnt);
 	dc.draw(weight);
 }
 
 void DrawMarkerInfo::moveMarkerInfo(Gfx::ICanvas &canvas,
     const Geom::Rect &boundary,
+    Id id,
     Content &cnt1,
     double weight1,
     Content &cnt2,
     double weight2) const
 {
-	MarkerDC dc1(*this, canvas, boundary, cnt1);
-	MarkerDC dc2(*this, canvas, boundary, cnt2);
+	MarkerDC dc1(*this, canvas, boundary, id, cnt1);
+	MarkerDC dc2(*this, canvas, boundary, id, cnt2);
 	dc1.interpolate(weight1, dc2, weight2);
 	dc1.draw(weight1);
 	dc2.draw(weight2);
@@ -1,8 +1,17 @@
 #ifndef CHART_RENDERING_DRAWMARKERINFO_H
 #define CHART_RENDERING_DRAWMARKERINFO_H
 
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <utility>
+#include <vector>
+
+#include "base/anim/interpolated.h"
 #include "base/gfx/canvas.h"
+#include "base/gfx/color.h"
 #include "base/gfx/draw/textbox.h"
+#include "base/gfx/font.h"
 #include "chart/generator/plot.h"
 #include "chart/main/layout.h"
 #include "chart/main/style.h"
@@ -20,6 +29,37 @@ class DrawMarkerInfo : public DrawingContext
 public:
 	using TextBox = Gfx::Draw::TextBox;
 	using Content = const Gen::Plot::MarkerInfoContent;
+	using Id = Gen::Plot::MarkerInfoId;
+
+	// measured tooltip texts kept between the frames while the
+	// content, the style and the text measurement are unchanged
+	class TextCache
+	{
+	public:
+		struct Key
+		{
+			decltype(Gen::Plot::MarkerInfoContent::info) info;
+			Gfx::Font font;
+			double fontSize{};
+			::Anim::Interpolated<Styles::Tooltip::Layout> layout;
+			Gfx::Color color;
+			double borderRadius{};
+			::Anim::String seriesName;
+			std::size_t textGeneration{};
+
+			bool operator==(const Key &) const = default;
+		};
+
+		std::shared_ptr<TextBox> &get(Id id, Key &&key);
+		void retain(const Gen::Plot::MarkersInfo &markersInfo);
+
+	private:
+		static constexpr std::size_t maxPerId = 2;
+
+		std::map<Id,
+		    std::vector<std::pair<Key, std::shared_ptr<TextBox>>>>
+		    texts;
+	};
 
 	class MarkerDC
 	{
@@ -27,6 +67,7 @@ public:
 		MarkerDC(const DrawMarkerInfo &parent,
 		    Gfx::ICanvas &canvas,
 		    const Geom::Rect &boundary,
+		    Id id,
 		    Content &content);
 		void draw(double weight);
 		void
@@ -35,14 +76,15 @@ public:
 	protected:
 		const DrawMarkerInfo &parent;
 		Gfx::ICanvas &canvas;
-		TextBox text;
+		std::shared_ptr<TextBox> text;
 		Geom::Point dataPoint;
 		Geom::Point labelDir;
 		Geom::Point arrow;
 		Geom::Rect bubble;
 
 		void loadMarker(Content &cnt);
-		void fillTextBox(Content &cnt);
+		[[nodiscard]] std::shared_ptr<TextBox> createTextBox(
+		    Content &cnt) const;
 		void calculateLayout(Geom::Point hint = Geom::Point{0, 0});
 	};
 
@@ -53,14 +95,17 @@ public:
 private:
 	void fadeInMarkerInfo(Gfx::ICanvas &canvas,
 	    const Geom::Rect &boundary,
+	    Id id,
 	    Content &cnt,
 	    double weight) const;
 	void fadeOutMarkerInfo(Gfx::ICanvas &canvas,
 	    const Geom::Rect &boundary,
+	    Id id,
 	    Content &cnt,
 	    double weight) const;
 	void moveMarkerInfo(Gfx::ICanvas &canvas,
 	    const Geom::Rect &boundary,
+	    Id id,
 	    Content &cnt1,
 	    double weight1,
 	    Content &cnt2,
@@ -1,5 +1,6 @@
 #include "drawplot.h"
 
+#include <optional>
 #include <utility>
 
 #include "base/geom/rect.h"
@@ -9,27 +10,33 @@
 
 #include "drawaxes.h"
 #include "drawbackground.h"
+#include "markercache.h"
 #include "markerrenderer.h"
+#include "rendercache.h"
 #include "renderedchart.h"
 
 namespace Vizzu::Draw
 {
 
-void DrawPlot::draw(Gfx::ICanvas &canvas,
+void DrawPlot::drawBackground(Gfx::ICanvas &canvas,
     Painter &painter,
-    const Geom::Rect &plotRect) const
+    const Geom::Rect &plotRect,
+    const DrawAxes &axes) const
 {
 	DrawBackground{{ctx()}}.draw(canvas,
 	    plotRect,
 	    rootStyle.plot,
 	    *rootEvents.draw.plot.background,
-	    Events::Targets::plot());
+	    Events::Targets::plot(renderedChart.getTargetPool()));
 
 	drawPlotArea(canvas, painter, false);
 
-	auto axes = DrawAxes{{ctx()}, canvas, painter, {}, {}, {}}.init();
 	axes.drawGeometries();
+}
 
+void DrawPlot::drawMarkers(Gfx::ICanvas &canvas,
+    Painter &painter) const
+{
 	auto clip = rootStyle.plot.overflow == Styles::Overflow::hidden;
 
 	if (clip) {
@@ -37,7 +44,9 @@ void DrawPlot::draw(Gfx::ICanvas &canvas,
 		drawPlotArea(canvas, painter, true);
 	}
 
-	auto &&markerRenderer = MarkerRenderer::create(ctx());
+	std::optional<MarkerCache> frameCache;
+	auto &&markerRenderer = MarkerRenderer::create(ctx(),
+	    cache ? cache->markers : frameCache.emplace());
 	markerRenderer.drawLines(canvas, painter);
 
 	markerRenderer.drawMarkers(canvas, painter);
@@ -45,15 +54,14 @@ void DrawPlot::draw(Gfx::ICanvas &canvas,
 	if (clip) canvas.restore();
 
 	markerRenderer.drawLabels(canvas);
-
-	axes.drawLabels();
 }
 
 void DrawPlot::drawPlotArea(Gfx::ICanvas &canvas,
     Painter &painter,
     bool clip) const
 {
-	auto areaElement = Events::Targets::area();
+	auto areaElement =
+	    Events::Targets::area(renderedChart.getTargetPool());
 
 	auto rect = Geom::Rect::Ident();
 	painter.setPolygonToCircleFactor(0.0);
@@ -1,6 +1,7 @@
 #ifndef DRAW_PLOT_H
 #define DRAW_PLOT_H
 
+#include "drawaxes.h"
 #include "drawingcontext.h"
 #include "markerrenderer.h"
 
@@ -12,9 +13,16 @@ class AbstractMarker;
 class DrawPlot : public DrawingContext
 {
 public:
-	void draw(Gfx::ICanvas &canvas,
+	// the plot is drawn in stages, each of them can be replayed from
+	// a cached layer: the background with the axis geometries, the
+	// markers and the axis labels
+
+	void drawBackground(Gfx::ICanvas &canvas,
 	    Painter &painter,
-	    const Geom::Rect &plotRect) const;
+	    const Geom::Rect &plotRect,
+	    const DrawAxes &axes) const;
+
+	void drawMarkers(Gfx::ICanvas &canvas, Painter &painter) const;
 
 private:
 	void drawPlotArea(Gfx::ICanvas &canvas,
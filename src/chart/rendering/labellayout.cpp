@@ -0,0 +1,62 @@
+#include "labellayout.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+#include "base/geom/point.h"
+#include "base/geom/quadrilateral.h"
+#include "base/geom/rect.h"
+#include "base/geom/transformedrect.h"
+
+namespace Vizzu::Draw
+{
+
+LabelLayout::LabelLayout(double cellSize) : cellSize(cellSize) {}
+
+bool LabelLayout::place(const Geom::TransformedRect &label)
+{
+	const Geom::ConvexQuad quad{{label.transform(Geom::Point{}),
+	    label.transform(Geom::Point{label.size.x, 0}),
+	    label.transform(Geom::Point{label.size.x, label.size.y}),
+	    label.transform(Geom::Point{0, label.size.y})}};
+
+	auto bounds = quad.boundary();
+	if (!std::isfinite(bounds.left()) || !std::isfinite(bounds.right())
+	    || !std::isfinite(bounds.bottom())
+	    || !std::isfinite(bounds.top()))
+		return false;
+
+	auto cell = [this](double pos)
+	{
+		return static_cast<std::int32_t>(
+		    std::clamp(std::floor(pos / cellSize), -1e9, 1e9));
+	};
+	auto x0 = cell(bounds.left());
+	auto x1 = cell(bounds.right());
+	auto y0 = cell(bounds.bottom());
+	auto y1 = cell(bounds.top());
+
+	auto key = [](std::int32_t x, std::int32_t y)
+	{
+		return static_cast<std::uint64_t>(static_cast<std::uint32_t>(x))
+		         << 32U
+		     | static_cast<std::uint32_t>(y);
+	};
+
+	for (auto y = y0; y <= y1; ++y)
+		for (auto x = x0; x <= x1; ++x)
+			if (auto it = cells.find(key(x, y)); it != cells.end())
+				for (auto index : it->second)
+					if (placed[index].overlaps(quad)) return false;
+
+	auto index = static_cast<std::uint32_t>(placed.size());
+	placed.push_back(quad);
+	for (auto y = y0; y <= y1; ++y)
+		for (auto x = x0; x <= x1; ++x)
+			cells[key(x, y)].push_back(index);
+	return true;
+}
+
+}
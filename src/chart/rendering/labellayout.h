@@ -0,0 +1,43 @@
+#ifndef CHART_RENDERING_LABELLAYOUT_H
+#define CHART_RENDERING_LABELLAYOUT_H
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+#include "base/geom/quadrilateral.h"
+#include "base/geom/transformedrect.h"
+
+namespace Vizzu::Draw
+{
+
+// Greedy label placement: a label is placed only if it does not
+// overlap any label placed before it, so the drawing order decides
+// the priority. Placed labels are binned into a uniform grid.
+class LabelLayout
+{
+public:
+	// labels fainter than this neither take up nor need space, so a
+	// fading label does not block the one replacing it
+	static constexpr double minAlpha = 0.1;
+
+	explicit LabelLayout(double cellSize = 64.0);
+
+	bool place(const Geom::TransformedRect &label);
+
+	[[nodiscard]] static LabelLayout *forAlpha(LabelLayout *layout,
+	    double alpha)
+	{
+		return alpha < minAlpha ? nullptr : layout;
+	}
+
+private:
+	double cellSize;
+	std::vector<Geom::ConvexQuad> placed;
+	std::unordered_map<std::uint64_t, std::vector<std::uint32_t>>
+	    cells;
+};
+
+}
+
+#endif
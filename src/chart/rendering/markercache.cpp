@@ -0,0 +1,113 @@
+#include "markercache.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+
+#include "base/anim/interpolated.h"
+#include "chart/generator/axis.h"
+#include "chart/generator/marker.h"
+#include "chart/generator/plot.h" // NOLINT(misc-include-cleaner)
+#include "markers/abstractmarker.h"
+
+#include "drawingcontext.h"
+
+namespace Vizzu::Draw
+{
+
+MarkerCache::Inputs::Inputs(const Gen::Marker &marker) :
+    position(marker.position),
+    size(marker.size),
+    spacing(marker.spacing),
+    sizeFactor(marker.sizeFactor),
+    enabled(marker.enabled),
+    interpolatesPrev(marker.prevMainMarker.interpolates()),
+    polarConnection(marker.polarConnection)
+{
+	for (auto index : {::Anim::first, ::Anim::second}) {
+		const auto &prev = marker.prevMainMarker.get_or_first(index);
+		auto i = static_cast<std::size_t>(index);
+		hasPrev[i] = !prev.value.idx.empty();
+		prevDistance[i] = prev.value.distance;
+		prevWeight[i] = prev.weight;
+	}
+}
+
+std::span<const AbstractMarker> MarkerCache::update(
+    const DrawingContext &ctx)
+{
+	const auto &plotMarkers = ctx.plot->getMarkers();
+	const auto &options = ctx.getOptions();
+	const auto &xAxis = ctx.plot->axises.at(Gen::AxisId::x);
+	const auto &style = ctx.rootStyle.plot.marker;
+
+	Key actKey{plotMarkers.data(),
+	    plotMarkers.size(),
+	    ctx.coordSys,
+	    options.coordSystem,
+	    options.geometry,
+	    options.orientation,
+	    xAxis.dimension.hasMarker,
+	    xAxis.measure.enabled,
+	    style.lineMinWidth,
+	    style.lineMaxWidth,
+	    style.circleMinRadius,
+	    style.circleMaxRadius,
+	    style.rectangleSpacing};
+
+	auto valid = key == actKey;
+	if (!valid) {
+		key = std::move(actKey);
+		inputs.clear();
+		slots.clear();
+	}
+
+	auto count = plotMarkers.size();
+	changed.assign(count, !valid);
+	for (auto i = 0U; i < count; ++i) {
+		Inputs actInputs(plotMarkers[i]);
+		if (i < inputs.size()) {
+			if (inputs[i] == actInputs) continue;
+			inputs[i] = std::move(actInputs);
+		}
+		else
+			inputs.push_back(std::move(actInputs));
+		changed[i] = true;
+	}
+	slots.resize(count, noSlot);
+
+	// connecting markers are built from their previous marker too
+	auto reusable = [this, count](std::size_t i, std::uint32_t slot)
+	{
+		if (changed[i] || slot == noSlot) return false;
+		for (auto index : {0U, 1U}) {
+			if (!inputs[i].hasPrev[index]) continue;
+			auto prev = static_cast<std::ptrdiff_t>(i)
+			          + inputs[i].prevDistance[index];
+			if (prev < 0 || static_cast<std::size_t>(prev) >= count
+			    || changed[static_cast<std::size_t>(prev)])
+				return false;
+		}
+		return true;
+	};
+
+	previous.swap(markers);
+	markers.clear();
+	for (auto i = 0U; i < count; ++i) {
+		const auto &marker = plotMarkers[i];
+		auto slot = std::exchange(slots[i], noSlot);
+		if (marker.enabled == false) continue;
+
+		if (reusable(i, slot))
+			markers.push_back(previous[slot]);
+		else
+			markers.push_back(AbstractMarker::createInterpolated(ctx,
+			    marker,
+			    ::Anim::first));
+		slots[i] = static_cast<std::uint32_t>(markers.size() - 1);
+	}
+	return markers;
+}
+
+}
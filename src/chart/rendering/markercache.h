@@ -0,0 +1,99 @@
+#ifndef CHART_RENDERING_MARKERCACHE_H
+#define CHART_RENDERING_MARKERCACHE_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "base/anim/interpolated.h"
+#include "base/geom/circle.h"
+#include "base/geom/point.h"
+#include "base/geom/rect.h"
+#include "base/gfx/color.h"
+#include "base/math/fuzzybool.h"
+#include "chart/generator/marker.h"
+#include "chart/main/style.h"
+#include "chart/options/options.h"
+#include "markers/abstractmarker.h"
+
+#include "colorbuilder.h"
+#include "drawingcontext.h"
+
+namespace Vizzu::Draw
+{
+
+// Keeps the abstract markers of the previous frame and recomputes
+// only the ones whose inputs changed since then.
+class MarkerCache
+{
+public:
+	std::span<const AbstractMarker> update(const DrawingContext &ctx);
+
+	// Scratch storage of the marker renderer, kept to reuse its
+	// capacity in the next frame.
+	struct Buffers
+	{
+		ColorBuilder::Tables colorTables;
+		std::vector<Gfx::Color> markerColors;
+		std::vector<const AbstractMarker *> recorded;
+		std::vector<Geom::Rect> rects;
+		std::vector<Geom::Circle> circles;
+		std::vector<Gfx::Color> brushColors;
+		std::vector<Gfx::Color> lineColors;
+	};
+
+	Buffers buffers;
+
+private:
+	struct Key
+	{
+		const Gen::Marker *markers{};
+		std::size_t count{};
+		CoordinateSystem coordSys;
+		::Anim::Interpolated<Gen::CoordSystem> coordSystem;
+		::Anim::Interpolated<Gen::ShapeType> geometry;
+		Gen::Options::Orientation orientation;
+		bool xHasMarker{};
+		::Anim::Interpolated<bool> xMeasureEnabled;
+		Styles::Param<double> lineMinWidth;
+		Styles::Param<double> lineMaxWidth;
+		Styles::Param<double> circleMinRadius;
+		Styles::Param<double> circleMaxRadius;
+		decltype(Styles::Marker::rectangleSpacing) rectangleSpacing;
+
+		bool operator==(const Key &) const = default;
+	};
+
+	struct Inputs
+	{
+		Geom::Point position;
+		Geom::Point size;
+		Geom::Point spacing;
+		double sizeFactor{};
+		Math::FuzzyBool enabled;
+		bool interpolatesPrev{};
+		std::array<bool, 2> hasPrev{};
+		std::array<std::ptrdiff_t, 2> prevDistance{};
+		std::array<double, 2> prevWeight{};
+		::Anim::Interpolated<bool> polarConnection;
+
+		explicit Inputs(const Gen::Marker &marker);
+		bool operator==(const Inputs &) const = default;
+	};
+
+	static constexpr auto noSlot = static_cast<std::uint32_t>(-1);
+
+	std::optional<Key> key;
+	std::vector<Inputs> inputs;
+	std::vector<bool> changed;
+	std::vector<std::uint32_t> slots;
+	std::vector<AbstractMarker> markers;
+	std::vector<AbstractMarker> previous;
+};
+
+}
+
+#endif
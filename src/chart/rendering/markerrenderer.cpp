@@ -1,17 +1,26 @@
 #include "markerrenderer.h"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <cstddef>
+#include <cstdint>
+#include <functional>
 #include <optional>
+#include <span>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "base/anim/interpolated.h"
+#include "base/geom/circle.h"
 #include "base/geom/line.h"
+#include "base/geom/rect.h"
 #include "base/gfx/canvas.h"
 #include "base/gfx/colortransform.h"
 #include "base/math/interpolation.h"
 #include "base/text/smartstring.h"
+#include "base/util/profiler.h"
 #include "chart/generator/plot.h" // NOLINT(misc-include-cleaner)
 #include "chart/main/events.h"
 #include "chart/options/channel.h"
@@ -24,11 +33,94 @@
 
 #include "colorbuilder.h"
 #include "drawingcontext.h"
+#include "labellayout.h"
+#include "markercache.h"
 #include "orientedlabel.h"
 #include "renderedchart.h"
+#include "tilebins.h"
 
 namespace Vizzu::Draw
 {
+namespace
+{
+constexpr std::size_t minTiledMarkers = 1024;
+
+Geom::Rect bounds(const Geom::Rect &rect) { return rect.positive(); }
+
+Geom::Rect bounds(const Geom::Circle &circle)
+{
+	return circle.boundary();
+}
+
+bool drawShapes(Gfx::ICanvas &canvas,
+    std::span<const Geom::Rect> rects,
+    std::span<const Gfx::Color> brushColors,
+    std::span<const Gfx::Color> lineColors)
+{
+	return canvas.rectangles(rects, brushColors, lineColors);
+}
+
+bool drawShapes(Gfx::ICanvas &canvas,
+    std::span<const Geom::Circle> circles,
+    std::span<const Gfx::Color> brushColors,
+    std::span<const Gfx::Color> lineColors)
+{
+	return canvas.circles(circles, brushColors, lineColors);
+}
+
+// bins the shapes into the tiles of the canvas, each tile draws
+// its shapes in the original order, so the z-order is kept
+template <class Shape>
+bool drawTiled(Gfx::ICanvas &canvas,
+    const std::vector<Shape> &shapes,
+    const std::vector<Gfx::Color> &brushColors,
+    const std::vector<Gfx::Color> &lineColors,
+    double margin)
+{
+	auto grid = canvas.tileGrid();
+	if (shapes.size() < minTiledMarkers
+	    || grid.columns * grid.rows < 2)
+		return false;
+
+	TileBins bins{grid};
+	for (auto i = 0U; i < shapes.size(); ++i)
+		bins.add(i, bounds(shapes[i]), margin);
+
+	return canvas.drawTiles(
+	    [&](std::size_t index, Gfx::ICanvas &tile)
+	    {
+		    auto bin = bins[index];
+		    if (bin.empty()) return;
+
+		    std::vector<Shape> tileShapes;
+		    std::vector<Gfx::Color> tileBrushColors;
+		    std::vector<Gfx::Color> tileLineColors;
+		    tileShapes.reserve(bin.size());
+		    tileBrushColors.reserve(bin.size());
+		    tileLineColors.reserve(bin.size());
+		    for (auto i : bin) {
+			    tileShapes.push_back(shapes[i]);
+			    tileBrushColors.push_back(brushColors[i]);
+			    tileLineColors.push_back(lineColors[i]);
+		    }
+		    drawShapes(tile,
+		        tileShapes,
+		        tileBrushColors,
+		        tileLineColors);
+	    });
+}
+
+template <class Shape>
+bool drawBatch(Gfx::ICanvas &canvas,
+    const std::vector<Shape> &shapes,
+    const std::vector<Gfx::Color> &brushColors,
+    const std::vector<Gfx::Color> &lineColors,
+    double margin)
+{
+	return drawTiled(canvas, shapes, brushColors, lineColors, margin)
+	    || drawShapes(canvas, shapes, brushColors, lineColors);
+}
+}
 
 void MarkerRenderer::drawLines(Gfx::ICanvas &canvas,
     Painter &painter) const
@@ -55,6 +147,7 @@ void MarkerRenderer::drawLines(Gfx::ICanvas &canvas,
 	canvas.setLineWidth(*style.lineWidth);
 
 	auto origo = plot->axises.origo();
+	auto &onDraw = *rootEvents.draw.plot.marker.guide;
 
 	for (const auto &blended : markers) {
 		if (blended.marker.enabled == false
@@ -66,14 +159,16 @@ void MarkerRenderer::drawLines(Gfx::ICanvas &canvas,
 			auto axisPoint = blended.center.xComp() + origo.yComp();
 			const Geom::Line line(axisPoint, blended.center);
 
-			auto guideElement =
-			    Events::Targets::markerGuide(blended.marker,
-			        blended.dataPosition,
-			        Gen::AxisId::y);
+			auto guideElement = Events::Targets::markerGuide(
+			    renderedChart.getTargetPool(),
+			    blended.marker,
+			    blended.dataPosition,
+			    Gen::AxisId::y);
 
-			if (rootEvents.draw.plot.marker.guide->invoke(
-			        Events::OnLineDrawEvent(*guideElement,
-			            {line, true}))) {
+			if (!onDraw.hasListeners()
+			    || onDraw.invoke(Events::OnLineDrawEvent(
+			        *guideElement,
+			        {line, true}))) {
 				painter.drawLine(line);
 				renderedChart.emplace(Draw::Line{line, true},
 				    std::move(guideElement));
@@ -89,14 +184,16 @@ void MarkerRenderer::drawLines(Gfx::ICanvas &canvas,
 			auto axisPoint = center.yComp() + origo.xComp();
 			const Geom::Line line(center, axisPoint);
 
-			auto guideElement =
-			    Events::Targets::markerGuide(blended.marker,
-			        blended.dataPosition,
-			        Gen::AxisId::x);
+			auto guideElement = Events::Targets::markerGuide(
+			    renderedChart.getTargetPool(),
+			    blended.marker,
+			    blended.dataPosition,
+			    Gen::AxisId::x);
 
-			if (rootEvents.draw.plot.marker.guide->invoke(
-			        Events::OnLineDrawEvent(*guideElement,
-			            {line, true}))) {
+			if (!onDraw.hasListeners()
+			    || onDraw.invoke(Events::OnLineDrawEvent(
+			        *guideElement,
+			        {line, true}))) {
 				painter.drawLine(line);
 				renderedChart.emplace(Draw::Line{line, true},
 				    std::move(guideElement));
@@ -109,6 +206,16 @@ void MarkerRenderer::drawLines(Gfx::ICanvas &canvas,
 void MarkerRenderer::drawMarkers(Gfx::ICanvas &canvas,
     Painter &painter) const
 {
+	if (Util::Profiler::isEnabled())
+		Util::Profiler::count("markers",
+		    static_cast<double>(std::ranges::count_if(markers,
+		        [](const AbstractMarker &marker)
+		        {
+			        return marker.enabled != false;
+		        })));
+
+	if (drawPlainMarkers(canvas, painter)) return;
+
 	for (const auto &blended : markers) {
 		if (getOptions().geometry.contains(Gen::ShapeType::line)
 		    && getOptions().geometry.contains(
@@ -224,6 +331,100 @@ void MarkerRenderer::drawMarkers(Gfx::ICanvas &canvas,
 	}
 }
 
+bool MarkerRenderer::drawPlainMarkers(Gfx::ICanvas &canvas,
+    const Painter &painter) const
+{
+	const auto &geometry = getOptions().geometry;
+	auto isCircle = geometry.factor(Gen::ShapeType::circle) == 1.0;
+	if ((!isCircle
+	        && geometry.factor(Gen::ShapeType::rectangle) != 1.0)
+	    || rootEvents.draw.plot.marker.base->hasListeners())
+		return false;
+
+	auto &recorded = buffers->recorded;
+	auto &rects = buffers->rects;
+	auto &circles = buffers->circles;
+	auto &brushColors = buffers->brushColors;
+	auto &lineColors = buffers->lineColors;
+	recorded.clear();
+	rects.clear();
+	circles.clear();
+	brushColors.clear();
+	lineColors.clear();
+
+	for (const auto &blended : markers) {
+		auto weight = blended.marker.prevMainMarker.combine<double>(
+		    [](const Gen::Marker::RelativeMarkerIndex &pos)
+		    {
+			    return !pos.idx.empty();
+		    });
+		if (blended.enabled == false || weight == 0) continue;
+		if (blended.morphToCircle != isCircle) return false;
+
+		auto &&[borderColor, itemColor] = getColor(blended);
+		auto colorAlpha =
+		    Math::FuzzyBool::And<double>(blended.enabled, weight);
+		auto brushColor = itemColor * colorAlpha;
+		auto lineColor = borderColor * colorAlpha;
+
+		if (isCircle) {
+			auto circle = painter.plainCircle(blended.points);
+			if (!circle) return false;
+			// culled markers are still recorded for the hit testing
+			recorded.push_back(&blended);
+			if (isCulled(brushColor,
+			        lineColor,
+			        bounds(*circle),
+			        0.0))
+				continue;
+			circles.push_back(*circle);
+		}
+		else {
+			auto rect = painter.plainRect(blended.points);
+			if (!rect) return false;
+			recorded.push_back(&blended);
+			if (isCulled(brushColor, lineColor, bounds(*rect), 0.0))
+				continue;
+			rects.push_back(*rect);
+		}
+
+		brushColors.push_back(brushColor);
+		lineColors.push_back(lineColor);
+	}
+
+	const auto &borderWidth = *rootStyle.plot.marker.borderWidth;
+	auto margin = borderWidth / 2.0 + 1.0;
+	canvas.save();
+	canvas.setLineWidth(borderWidth);
+	auto batched =
+	    isCircle ? drawBatch(canvas,
+	                   circles,
+	                   brushColors,
+	                   lineColors,
+	                   margin)
+	             : drawBatch(canvas,
+	                   rects,
+	                   brushColors,
+	                   lineColors,
+	                   margin);
+	canvas.setLineWidth(0);
+	canvas.restore();
+
+	if (!batched) return false;
+
+	for (const auto *blended : recorded)
+		renderedChart.emplace(
+		    Marker{blended->marker.enabled != false,
+		        blended->shapeType,
+		        blended->points,
+		        blended->lineWidth},
+		    Events::Targets::marker(renderedChart.getTargetPool(),
+		        blended->marker,
+		        blended->dataPosition));
+
+	return true;
+}
+
 void MarkerRenderer::drawLabels(Gfx::ICanvas &canvas) const
 {
 	auto &&[unit, measure] = plot->axises.label;
@@ -240,18 +441,39 @@ void MarkerRenderer::drawLabels(Gfx::ICanvas &canvas) const
 	                          : ::Anim::first)
 	        .value;
 
+	std::optional<LabelLayout> layout;
+	if (rootStyle.plot.marker.label.overlap == Styles::Overlap::hidden)
+		layout.emplace();
+
 	for (const auto &blended : markers) {
 		if (blended.marker.enabled == false) continue;
-		drawLabel(canvas,
-		    blended,
-		    firstUnit,
-		    keepMeasure,
-		    ::Anim::first);
-		drawLabel(canvas,
-		    blended,
-		    secondUnit,
-		    keepMeasure,
-		    ::Anim::second);
+
+		// the outgoing and the incoming label of a marker share their
+		// place, only the dominant one takes part in the layout
+		auto dominant = getLabelAlpha(blended, ::Anim::second)
+		                      > getLabelAlpha(blended, ::Anim::first)
+		                  ? ::Anim::second
+		                  : ::Anim::first;
+		auto other = dominant == ::Anim::first ? ::Anim::second
+		                                       : ::Anim::first;
+		auto unitAt = [&](::Anim::InterpolateIndex index)
+		    -> const std::string &
+		{
+			return index == ::Anim::first ? firstUnit : secondUnit;
+		};
+
+		if (drawLabel(canvas,
+		        blended,
+		        unitAt(dominant),
+		        keepMeasure,
+		        dominant,
+		        layout ? &*layout : nullptr))
+			drawLabel(canvas,
+			    blended,
+			    unitAt(other),
+			    keepMeasure,
+			    other,
+			    nullptr);
 	}
 }
 
@@ -263,6 +485,38 @@ void MarkerRenderer::draw(Gfx::ICanvas &canvas,
 {
 	if (abstractMarker.enabled == false || factor == 0) return;
 
+	auto &&[borderColor, itemColor] = getColor(abstractMarker);
+	auto colorAlpha =
+	    Math::FuzzyBool::And<double>(abstractMarker.enabled, factor);
+	if (isLine)
+		colorAlpha = Math::FuzzyBool::And<double>(colorAlpha,
+		    abstractMarker.connected);
+
+	auto brushColor = itemColor * colorAlpha;
+	auto lineColor = isLine ? brushColor : borderColor * colorAlpha;
+
+	const auto &onDraw = *rootEvents.draw.plot.marker.base;
+
+	if (!onDraw.hasListeners()
+	    && isCulled(brushColor,
+	        lineColor,
+	        visibleArea ? getBounds(abstractMarker) : Geom::Rect{},
+	        isLine ? std::max(abstractMarker.lineWidth[0],
+	                     abstractMarker.lineWidth[1])
+	                     * coordSys.getRect().size.minSize()
+	               : 0.0)) {
+		// not drawn, but still recorded for the hit testing
+		renderedChart.emplace(
+		    Marker{abstractMarker.marker.enabled != false,
+		        abstractMarker.shapeType,
+		        abstractMarker.points,
+		        abstractMarker.lineWidth},
+		    Events::Targets::marker(renderedChart.getTargetPool(),
+		        abstractMarker.marker,
+		        abstractMarker.dataPosition));
+		return;
+	}
+
 	painter.setPolygonToCircleFactor(
 	    isLine ? 0.0
 	           : static_cast<double>(abstractMarker.morphToCircle));
@@ -273,27 +527,21 @@ void MarkerRenderer::draw(Gfx::ICanvas &canvas,
 
 	canvas.setLineWidth(*rootStyle.plot.marker.borderWidth);
 
-	auto &&[borderColor, itemColor] = getColor(abstractMarker);
-	auto colorAlpha =
-	    Math::FuzzyBool::And<double>(abstractMarker.enabled, factor);
-
 	if (auto markerElement =
-	        Events::Targets::marker(abstractMarker.marker,
+	        Events::Targets::marker(renderedChart.getTargetPool(),
+	            abstractMarker.marker,
 	            abstractMarker.dataPosition);
 	    isLine) {
 		auto line = abstractMarker.getLine();
 
-		colorAlpha = Math::FuzzyBool::And<double>(colorAlpha,
-		    abstractMarker.connected);
-
-		canvas.setBrushColor(itemColor * colorAlpha);
-		canvas.setLineColor(itemColor * colorAlpha);
+		canvas.setBrushColor(brushColor);
+		canvas.setLineColor(lineColor);
 
-		if (rootEvents.draw.plot.marker.base->invoke(
-		        Events::OnLineDrawEvent(*markerElement,
-		            {{coordSys.convert(line.begin),
-		                 coordSys.convert(line.end)},
-		                false}))) {
+		if (!onDraw.hasListeners()
+		    || onDraw.invoke(Events::OnLineDrawEvent(*markerElement,
+		        {{coordSys.convert(line.begin),
+		             coordSys.convert(line.end)},
+		            false}))) {
 			painter.drawStraightLine(line,
 			    abstractMarker.lineWidth,
 			    getOptions().coordSystem.factor(
@@ -311,12 +559,12 @@ void MarkerRenderer::draw(Gfx::ICanvas &canvas,
 		}
 	}
 	else {
-		canvas.setLineColor(borderColor * colorAlpha);
-		canvas.setBrushColor(itemColor * colorAlpha);
+		canvas.setLineColor(lineColor);
+		canvas.setBrushColor(brushColor);
 
-		if (rootEvents.draw.plot.marker.base->invoke(
-		        Events::OnRectDrawEvent(*markerElement,
-		            {abstractMarker.getBoundary(), true}))) {
+		if (!onDraw.hasListeners()
+		    || onDraw.invoke(Events::OnRectDrawEvent(*markerElement,
+		        {abstractMarker.getBoundary(), true}))) {
 			painter.drawPolygon(abstractMarker.points);
 			renderedChart.emplace(
 			    Marker{abstractMarker.marker.enabled != false,
@@ -331,29 +579,33 @@ void MarkerRenderer::draw(Gfx::ICanvas &canvas,
 	canvas.restore();
 }
 
-void MarkerRenderer::drawLabel(Gfx::ICanvas &canvas,
+double MarkerRenderer::getLabelAlpha(
+    const AbstractMarker &abstractMarker,
+    ::Anim::InterpolateIndex index)
+{
+	const auto &label = abstractMarker.marker.label;
+	auto weight = label.interpolates() || index == ::Anim::first
+	                ? label.get_or_first(index).weight
+	                : 0.0;
+	return Math::FuzzyBool::And<double>(abstractMarker.labelEnabled,
+	    weight);
+}
+
+bool MarkerRenderer::drawLabel(Gfx::ICanvas &canvas,
     const AbstractMarker &abstractMarker,
     const std::string &unit,
     bool keepMeasure,
-    ::Anim::InterpolateIndex index) const
+    ::Anim::InterpolateIndex index,
+    LabelLayout *layout) const
 {
-	if (abstractMarker.labelEnabled == false) return;
+	auto colorAlpha = getLabelAlpha(abstractMarker, index);
+	if (colorAlpha == 0.0) return true;
 	const auto &marker = abstractMarker.marker;
 
-	auto weight =
-	    marker.label.interpolates() || index == ::Anim::first
-	        ? marker.label.get_or_first(index).weight
-	        : 0.0;
-	if (weight == 0.0) return;
-
 	auto color = getColor(abstractMarker, true).second;
 
-	auto colorAlpha =
-	    Math::FuzzyBool::And<double>(abstractMarker.labelEnabled,
-	        weight);
-
 	auto text = getLabelText(marker.label, unit, keepMeasure, index);
-	if (text.empty()) return;
+	if (text.empty()) return true;
 
 	const auto &labelStyle = rootStyle.plot.marker.label;
 
@@ -366,7 +618,7 @@ void MarkerRenderer::drawLabel(Gfx::ICanvas &canvas,
 	auto centered = labelStyle.position->factor(
 	    Styles::MarkerLabel::Position::center);
 
-	OrientedLabel{{ctx()}}.draw(canvas,
+	return OrientedLabel{{ctx()}}.draw(canvas,
 	    text,
 	    labelPos,
 	    labelStyle,
@@ -374,9 +626,11 @@ void MarkerRenderer::drawLabel(Gfx::ICanvas &canvas,
 	    Gfx::ColorTransform::OverrideColor(
 	        (*labelStyle.filter)(color)*colorAlpha),
 	    *rootEvents.draw.plot.marker.label,
-	    Events::Targets::markerLabel(text,
+	    Events::Targets::markerLabel(renderedChart.getTargetPool(),
+	        text,
 	        marker,
-	        abstractMarker.dataPosition));
+	        abstractMarker.dataPosition),
+	    LabelLayout::forAlpha(layout, colorAlpha));
 }
 
 std::string MarkerRenderer::getLabelText(
@@ -431,6 +685,34 @@ std::string MarkerRenderer::getLabelText(
 	}
 }
 
+bool MarkerRenderer::isCulled(const Gfx::Color &brushColor,
+    const Gfx::Color &lineColor,
+    const Geom::Rect &bounds,
+    double margin) const
+{
+	const auto &borderWidth = *rootStyle.plot.marker.borderWidth;
+	if (brushColor.isTransparent()
+	    && (lineColor.isTransparent() || borderWidth <= 0))
+		return true;
+
+	if (!visibleArea) return false;
+
+	margin += borderWidth / 2.0 + 1.0;
+	return bounds.right() + margin < visibleArea->left()
+	    || bounds.left() - margin > visibleArea->right()
+	    || bounds.top() + margin < visibleArea->bottom()
+	    || bounds.bottom() - margin > visibleArea->top();
+}
+
+Geom::Rect MarkerRenderer::getBounds(
+    const AbstractMarker &abstractMarker) const
+{
+	std::array<Geom::Point, 4> converted;
+	for (auto i = 0U; i < converted.size(); ++i)
+		converted[i] = coordSys.convert(abstractMarker.points[i]);
+	return Geom::Rect::Boundary(converted);
+}
+
 std::pair<Gfx::Color, Gfx::Color> MarkerRenderer::getColor(
     const AbstractMarker &abstractMarker,
     bool label) const
@@ -470,12 +752,12 @@ std::pair<Gfx::Color, Gfx::Color> MarkerRenderer::getColor(
 Gfx::Color MarkerRenderer::getSelectedColor(const Gen::Marker &marker,
     bool label) const
 {
-	const ColorBuilder colorBuilder(
-	    rootStyle.plot.marker.lightnessRange(),
-	    *rootStyle.plot.marker.colorPalette,
-	    *rootStyle.plot.marker.colorGradient);
-
-	auto markerColor = colorBuilder.render(marker.colorBase);
+	const auto *first = plot->getMarkers().data();
+	auto markerColor =
+	    std::less_equal{}(first, &marker)
+	            && std::less{}(&marker, first + markerColors.size())
+	        ? markerColors[static_cast<std::size_t>(&marker - first)]
+	        : colorBuilder.render(marker.colorBase);
 
 	return label ? Math::interpolate(markerColor,
 	                   rootStyle.plot.marker.label.color->transparent(
@@ -484,15 +766,28 @@ Gfx::Color MarkerRenderer::getSelectedColor(const Gen::Marker &marker,
 	             : markerColor;
 }
 
-MarkerRenderer MarkerRenderer::create(const DrawingContext &ctx)
+MarkerRenderer MarkerRenderer::create(const DrawingContext &ctx,
+    MarkerCache &cache)
 {
-	MarkerRenderer res{{ctx}, {}};
-	for (auto &marker : res.plot->getMarkers()) {
-		if (marker.enabled == false) continue;
-
-		res.markers.push_back(AbstractMarker::createInterpolated(ctx,
-		    marker,
-		    ::Anim::first));
+	MarkerRenderer res{{ctx}, cache.update(ctx)};
+	const auto &markers = res.plot->getMarkers();
+	auto &buffers = cache.buffers;
+	buffers.markerColors.resize(markers.size());
+	res.colorBuilder.render(markers,
+	    buffers.markerColors,
+	    buffers.colorTables);
+	res.markerColors = buffers.markerColors;
+	res.buffers = &buffers;
+
+	// markers are clipped to the plot area, which is only a rectangle
+	// on the screen in cartesian coordinate system
+	if (res.rootStyle.plot.overflow == Styles::Overflow::hidden
+	    && res.coordSys.getPolar() == false) {
+		std::array<Geom::Point, 4> corners =
+		    Geom::Rect::Ident().points();
+		for (auto &corner : corners)
+			corner = res.coordSys.convert(corner);
+		res.visibleArea = Geom::Rect::Boundary(corners);
 	}
 	return res;
 }
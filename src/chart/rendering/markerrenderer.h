@@ -1,9 +1,18 @@
 #ifndef MARKERRENDERER_H
 #define MARKERRENDERER_H
 
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "base/geom/rect.h"
+#include "base/gfx/color.h"
 #include "chart/rendering/markers/abstractmarker.h"
 
+#include "colorbuilder.h"
 #include "drawingcontext.h"
+#include "labellayout.h"
+#include "markercache.h"
 
 namespace Vizzu::Draw
 {
@@ -11,15 +20,31 @@ namespace Vizzu::Draw
 class MarkerRenderer : public DrawingContext
 {
 public:
-	static MarkerRenderer create(const DrawingContext &ctx);
+	static MarkerRenderer create(const DrawingContext &ctx,
+	    MarkerCache &cache);
 
 	void drawLines(Gfx::ICanvas &canvas, Painter &painter) const;
 	void drawMarkers(Gfx::ICanvas &canvas, Painter &painter) const;
 	void drawLabels(Gfx::ICanvas &canvas) const;
 
-	std::vector<AbstractMarker> markers;
+	std::span<const AbstractMarker> markers;
+	const ColorBuilder colorBuilder = {
+	    rootStyle.plot.marker.lightnessRange(),
+	    *rootStyle.plot.marker.colorPalette,
+	    *rootStyle.plot.marker.colorGradient};
+	std::span<const Gfx::Color> markerColors{};
+	std::optional<Geom::Rect> visibleArea{};
+	MarkerCache::Buffers *buffers{};
 
 private:
+	[[nodiscard]] bool isCulled(const Gfx::Color &brushColor,
+	    const Gfx::Color &lineColor,
+	    const Geom::Rect &bounds,
+	    double margin) const;
+	[[nodiscard]] Geom::Rect getBounds(
+	    const AbstractMarker &abstractMarker) const;
+	bool drawPlainMarkers(Gfx::ICanvas &canvas,
+	    const Painter &painter) const;
 	[[nodiscard]] std::pair<Gfx::Color, Gfx::Color> getColor(
 	    const AbstractMarker &abstractMarker,
 	    bool label = false) const;
@@ -28,11 +53,15 @@ private:
 	    const AbstractMarker &abstractMarker,
 	    double factor,
 	    bool isLine) const;
-	void drawLabel(Gfx::ICanvas &canvas,
+	[[nodiscard]] static double getLabelAlpha(
+	    const AbstractMarker &abstractMarker,
+	    ::Anim::InterpolateIndex index);
+	bool drawLabel(Gfx::ICanvas &canvas,
 	    const AbstractMarker &abstractMarker,
 	    const std::string &unit,
 	    bool keepMeasure,
-	    ::Anim::InterpolateIndex index) const;
+	    ::Anim::InterpolateIndex index,
+	    LabelLayout *layout) const;
 
 	[[nodiscard]] Gfx::Color
 	getSelectedColor(const Gen::Marker &marker, bool label) const;
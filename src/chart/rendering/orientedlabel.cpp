@@ -16,18 +16,20 @@
 #include "chart/main/style.h"
 
 #include "drawlabel.h"
+#include "labellayout.h"
 
 namespace Vizzu::Draw
 {
 
-void OrientedLabel::draw(Gfx::ICanvas &canvas,
+bool OrientedLabel::draw(Gfx::ICanvas &canvas,
     const std::string &text,
     const Geom::Line &labelPos,
     const Styles::OrientedLabel &labelStyle,
     double centered,
     Gfx::ColorTransform &&colorTransform,
     Util::EventDispatcher::Event &event,
-    std::unique_ptr<Util::EventTarget> eventTarget) const
+    EventTargetPtr eventTarget,
+    LabelLayout *layout) const
 {
 	auto baseAngle =
 	    labelPos.getDirection().angle() + std::numbers::pi / 2.0;
@@ -84,6 +86,9 @@ void OrientedLabel::draw(Gfx::ICanvas &canvas,
 		              1.0,
 		              -std::numbers::pi);
 
+	if (layout && !layout->place({transform, paddedSize}))
+		return false;
+
 	DrawLabel::draw(canvas,
 	    {transform, paddedSize},
 	    text,
@@ -91,6 +96,7 @@ void OrientedLabel::draw(Gfx::ICanvas &canvas,
 	    event,
 	    std::move(eventTarget),
 	    {.colorTransform = std::move(colorTransform)});
+	return true;
 }
 
 }
\ No newline at end of file
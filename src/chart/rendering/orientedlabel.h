@@ -7,20 +7,23 @@
 #include "chart/rendering/drawlabel.h"
 
 #include "drawingcontext.h"
+#include "labellayout.h"
 
 namespace Vizzu::Draw
 {
 
 struct OrientedLabel : DrawLabel
 {
-	void draw(Gfx::ICanvas &canvas,
+	// false if the label was rejected by the layout
+	bool draw(Gfx::ICanvas &canvas,
 	    const std::string &text,
 	    const Geom::Line &labelPos,
 	    const Styles::OrientedLabel &labelStyle,
 	    double centered,
 	    Gfx::ColorTransform &&colorTransform,
 	    Util::EventDispatcher::Event &event,
-	    std::unique_ptr<Util::EventTarget> eventTarget) const;
+	    EventTargetPtr eventTarget,
+	    LabelLayout *layout = nullptr) const;
 };
 }
 
@@ -25,6 +25,8 @@ public:
 		return polar;
 	}
 
+	bool operator==(const PolarDescartesTransform &) const = default;
+
 protected:
 	bool zoomOut{};
 	Math::FuzzyBool polar;
@@ -50,6 +52,13 @@ public:
 	[[nodiscard]] Geom::Rect getRect() const;
 	[[nodiscard]] double getAngle() const;
 
+	[[nodiscard]] const Math::FuzzyBool &getPolar() const
+	{
+		return polarDescartes.getPolar();
+	}
+
+	bool operator==(const CompoundTransform &) const = default;
+
 private:
 	PolarDescartesTransform polarDescartes;
 	Geom::Rect rect;
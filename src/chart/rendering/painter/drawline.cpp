@@ -1,6 +1,8 @@
 #include "drawline.h"
 
 #include <array>
+#include <cstddef>
+#include <vector>
 
 #include "base/geom/line.h"
 #include "base/geom/quadrilateral.h"
@@ -16,15 +18,21 @@ namespace Vizzu::Draw
 
 DrawLine::DrawLine(const Geom::Line &line,
     const PathSampler::Options &options,
-    Gfx::ICanvas &canvas)
+    Gfx::ICanvas &canvas,
+    std::vector<Geom::Point> &points)
 {
-	Path(line.begin, line.end, canvas, options).sample();
+	points.clear();
+	Path(line.begin, line.end, options).sample(points);
+
+	for (std::size_t i = 1; i < points.size(); ++i)
+		canvas.line(Geom::Line{points[i - 1], points[i]});
 }
 
 DrawLine::DrawLine(const Geom::Line &line,
     std::array<double, 2> widths,
     const Options &options,
-    Gfx::ICanvas &canvas)
+    Gfx::ICanvas &canvas,
+    std::vector<Geom::Point> &points)
 {
 	auto pBeg = options.coordSys.convert(line.begin);
 	auto pEnd = options.coordSys.convert(line.end);
@@ -50,44 +58,32 @@ DrawLine::DrawLine(const Geom::Line &line,
 			canvas.endPolygon();
 		}
 		else {
-			DrawPolygon({options.coordSys.getOriginal(p0),
-			                options.coordSys.getOriginal(p1),
-			                options.coordSys.getOriginal(p2),
-			                options.coordSys.getOriginal(p3)},
+			points.clear();
+			auto circle = DrawPolygon::sample(
+			    {options.coordSys.getOriginal(p0),
+			        options.coordSys.getOriginal(p1),
+			        options.coordSys.getOriginal(p2),
+			        options.coordSys.getOriginal(p3)},
 			    {static_cast<const PathSampler::Options &>(options),
 			        {.toCircleFactor = 0,
 			            .straightFactor = options.straightFactor}},
-			    canvas,
-			    false);
+			    points);
+			DrawPolygon::draw(circle, points, canvas, false);
 		}
 	}
 }
 
-DrawLine::Path::Path(const Geom::Point &p0,
-    const Geom::Point &p1,
-    Gfx::ICanvas &canvas,
-    const Options &options) :
-    PathSampler(p0, p1, options),
-    canvas(canvas)
-{}
-
-void DrawLine::Path::sample()
-{
-	lastPoint = getPoint(0.0);
-	calc();
-	addPoint(getPoint(1.0));
-}
-
-void DrawLine::Path::addPoint(const Geom::Point &point)
+void DrawLine::Path::sample(std::vector<Geom::Point> &points) const
 {
-	Geom::Line line;
-	line.begin = lastPoint;
-	line.end = point;
-	canvas.line(line);
-	lastPoint = point;
+	sampler.sample(
+	    [this](double i)
+	    {
+		    return getPoint(i);
+	    },
+	    points);
 }
 
-Geom::Point DrawLine::Path::getPoint(double i)
+Geom::Point DrawLine::Path::getPoint(double i) const
 {
 	return coordSys.convert(Math::interpolate<>(p0, p1, i));
 }
@@ -1,6 +1,9 @@
 #ifndef DRAWLINE_H
 #define DRAWLINE_H
 
+#include <array>
+#include <vector>
+
 #include "base/geom/line.h"
 #include "base/gfx/canvas.h"
 #include "base/gfx/color.h"
@@ -24,29 +27,25 @@ public:
 
 	DrawLine(const Geom::Line &line,
 	    const PathSampler::Options &options,
-	    Gfx::ICanvas &canvas);
+	    Gfx::ICanvas &canvas,
+	    std::vector<Geom::Point> &points);
 
 	DrawLine(const Geom::Line &line,
 	    std::array<double, 2> widths,
 	    const Options &options,
-	    Gfx::ICanvas &canvas);
+	    Gfx::ICanvas &canvas,
+	    std::vector<Geom::Point> &points);
 
 private:
 	class Path : public PathSampler
 	{
 	public:
-		Path(const Geom::Point &p0,
-		    const Geom::Point &p1,
-		    Gfx::ICanvas &canvas,
-		    const Options &options);
+		using PathSampler::PathSampler;
 
-		void sample();
+		void sample(std::vector<Geom::Point> &points) const;
 
 	private:
-		Gfx::ICanvas &canvas;
-		Geom::Point lastPoint;
-		void addPoint(const Geom::Point &point) override;
-		Geom::Point getPoint(double i) override;
+		[[nodiscard]] Geom::Point getPoint(double i) const;
 	};
 };
 
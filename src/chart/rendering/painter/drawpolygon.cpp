@@ -2,6 +2,8 @@
 
 #include <array>
 #include <cmath>
+#include <optional>
+#include <vector>
 
 #include "base/geom/circle.h"
 #include "base/geom/point.h"
@@ -15,32 +17,45 @@
 namespace Vizzu::Draw
 {
 
-DrawPolygon::DrawPolygon(const std::array<Geom::Point, 4> &ps,
+std::optional<Geom::Circle> DrawPolygon::sample(
+    const std::array<Geom::Point, 4> &ps,
     const Options &options,
-    Gfx::ICanvas &canvas,
-    bool clip) :
-    center(Math::mean(ps)),
-    boundary(Geom::Rect::Boundary(ps).size)
+    std::vector<Geom::Point> &points)
 {
+	auto center = Math::mean(ps);
+	auto boundary = Geom::Rect::Boundary(ps).size;
+
 	auto linSize = Geom::Size{options.coordSys.verConvert(boundary.x),
 	    options.coordSys.verConvert(boundary.y)};
 
 	if (options.toCircleFactor == 1.0 && linSize.isSquare(0.005)) {
 		auto centerConv = options.coordSys.convert(center);
 		auto radius = fabs(linSize.x) / 2.0;
-		const Geom::Circle circle(centerConv, radius);
+		return Geom::Circle(centerConv, radius);
+	}
+
+	Path(ps[0], ps[1], center, linSize, options).sample(points);
+	Path(ps[1], ps[2], center, linSize, options).sample(points);
+	Path(ps[2], ps[3], center, linSize, options).sample(points);
+	Path(ps[3], ps[0], center, linSize, options).sample(points);
+	return std::nullopt;
+}
+
+void DrawPolygon::draw(const std::optional<Geom::Circle> &circle,
+    const std::vector<Geom::Point> &points,
+    Gfx::ICanvas &canvas,
+    bool clip)
+{
+	if (circle) {
 		if (clip)
-			canvas.setClipCircle(circle);
+			canvas.setClipCircle(*circle);
 		else
-			canvas.circle(circle);
+			canvas.circle(*circle);
 	}
 	else {
 		canvas.beginPolygon();
 
-		Path(ps[0], ps[1], center, linSize, canvas, options).calc();
-		Path(ps[1], ps[2], center, linSize, canvas, options).calc();
-		Path(ps[2], ps[3], center, linSize, canvas, options).calc();
-		Path(ps[3], ps[0], center, linSize, canvas, options).calc();
+		for (const auto &point : points) canvas.addPoint(point);
 
 		if (clip)
 			canvas.setClipPolygon();
@@ -53,23 +68,27 @@ DrawPolygon::Path::Path(const Geom::Point &p0,
     const Geom::Point &p1,
     Geom::Point center,
     Geom::Point linSize,
-    Gfx::ICanvas &canvas,
     const DrawPolygon::Options &options) :
     PathSampler(p0, p1, options),
     options(options),
-    canvas(canvas),
     centerConv(options.coordSys.convert(center)),
     linP0(options.coordSys.convert(p0)),
     linP1(options.coordSys.convert(p1)),
     linSize(linSize)
 {}
 
-void DrawPolygon::Path::addPoint(const Geom::Point &point)
+void DrawPolygon::Path::sample(
+    std::vector<Geom::Point> &points) const
 {
-	canvas.addPoint(point);
+	sampler.sample(
+	    [this](double f)
+	    {
+		    return getPoint(f);
+	    },
+	    points);
 }
 
-Geom::Point DrawPolygon::Path::getPoint(double f)
+Geom::Point DrawPolygon::Path::getPoint(double f) const
 {
 	auto linP = Math::interpolate(linP0, linP1, f);
 	auto nonlinP =
@@ -82,13 +101,14 @@ Geom::Point DrawPolygon::Path::getPoint(double f)
 }
 
 Geom::Point DrawPolygon::Path::intpToElipse(Geom::Point point,
-    double factor)
+    double factor) const
 {
 	auto projected = projectToElipse(point);
 	return Math::interpolate(point, projected, factor);
 }
 
-Geom::Point DrawPolygon::Path::projectToElipse(Geom::Point point)
+Geom::Point DrawPolygon::Path::projectToElipse(
+    Geom::Point point) const
 {
 	auto fi = (point - centerConv).angle();
 	return centerConv + Geom::Point::Polar(1, fi) * linSize / 2.0;
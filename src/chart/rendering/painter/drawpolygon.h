@@ -2,8 +2,10 @@
 #define DRAWPOLYGON_H
 
 #include <array>
+#include <optional>
 #include <vector>
 
+#include "base/geom/circle.h"
 #include "base/geom/point.h"
 #include "base/gfx/canvas.h"
 #include "base/gfx/color.h"
@@ -20,13 +22,22 @@ public:
 	{
 		double toCircleFactor;
 		double straightFactor;
+
+		bool operator==(const PolygonOptions &) const = default;
 	};
 
 	struct Options : PathSampler::Options, PolygonOptions
 	{};
 
-	DrawPolygon(const std::array<Geom::Point, 4> &ps,
+	// returns the circle if the polygon is drawn as one,
+	// otherwise appends the sampled outline to points
+	[[nodiscard]] static std::optional<Geom::Circle> sample(
+	    const std::array<Geom::Point, 4> &ps,
 	    const Options &options,
+	    std::vector<Geom::Point> &points);
+
+	static void draw(const std::optional<Geom::Circle> &circle,
+	    const std::vector<Geom::Point> &points,
 	    Gfx::ICanvas &canvas,
 	    bool clip);
 
@@ -38,29 +49,25 @@ private:
 		    const Geom::Point &p1,
 		    Geom::Point center,
 		    Geom::Point linSize,
-		    Gfx::ICanvas &canvas,
 		    const DrawPolygon::Options &options);
 
-		using Gfx::PathSampler::calc;
+		void sample(std::vector<Geom::Point> &points) const;
 
 	private:
 		const DrawPolygon::Options &options;
-		Gfx::ICanvas &canvas;
 		Geom::Point centerConv;
 		Geom::Point linP0;
 		Geom::Point linP1;
 		Geom::Size linSize;
 
-		void addPoint(const Geom::Point &point) override;
-		Geom::Point getPoint(double f) override;
+		[[nodiscard]] Geom::Point getPoint(double f) const;
 
-		Geom::Point intpToElipse(Geom::Point point, double factor);
+		[[nodiscard]] Geom::Point intpToElipse(Geom::Point point,
+		    double factor) const;
 
-		Geom::Point projectToElipse(Geom::Point point);
+		[[nodiscard]] Geom::Point projectToElipse(
+		    Geom::Point point) const;
 	};
-
-	Geom::Point center;
-	Geom::Point boundary;
 };
 
 }
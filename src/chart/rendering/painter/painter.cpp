@@ -1,9 +1,18 @@
 #include "painter.h"
 
 #include <array>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+#include <optional>
+#include <utility>
 
+#include "base/geom/circle.h"
 #include "base/geom/line.h"
 #include "base/geom/point.h"
+#include "base/geom/rect.h"
+#include "base/math/statistics.h"
+#include "base/util/hash.h"
 
 #include "drawline.h"
 #include "drawpolygon.h"
@@ -11,9 +20,30 @@
 namespace Vizzu::Draw
 {
 
+void Painter::setCoordSys(const CoordinateSystem &system)
+{
+	if (this->system == system) {
+		previousOutlines.clear();
+		std::swap(previousOutlines, outlines);
+	}
+	else {
+		this->system = system;
+		outlines.clear();
+		previousOutlines.clear();
+	}
+}
+
+void Painter::setPathSamplerOptions(
+    const Gfx::PathSampler::Options &options)
+{
+	pathSampler.setOptions(options);
+	outlines.clear();
+	previousOutlines.clear();
+}
+
 void Painter::drawLine(const Geom::Line &line)
 {
-	DrawLine(line, {pathSamplerOptions, system}, getCanvas());
+	DrawLine(line, {pathSampler, system}, getCanvas(), points);
 }
 
 void Painter::drawStraightLine(const Geom::Line &line,
@@ -22,17 +52,106 @@ void Painter::drawStraightLine(const Geom::Line &line,
 {
 	DrawLine(line,
 	    widths,
-	    {{pathSamplerOptions, system}, {straightFactor}},
-	    getCanvas());
+	    {{pathSampler, system}, {straightFactor}},
+	    getCanvas(),
+	    points);
 }
 
 void Painter::drawPolygon(const std::array<Geom::Point, 4> &ps,
     bool clip)
 {
-	Draw::DrawPolygon(ps,
-	    {{pathSamplerOptions, system}, polygonOptions},
+	const auto &outline = getOutline(ps);
+	DrawPolygon::draw(outline.circle,
+	    outline.points,
 	    getCanvas(),
 	    clip);
 }
 
-}
\ No newline at end of file
+std::array<Geom::Point, 4> Painter::quantize(
+    const std::array<Geom::Point, 4> &ps) const
+{
+	auto scale = subPixelSteps * std::numbers::pi
+	           * system.getRect().size.diagonal();
+	if (!std::isfinite(scale) || scale <= 0.0) return ps;
+
+	std::array<Geom::Point, 4> res;
+	for (auto i = 0U; i < ps.size(); ++i)
+		res[i] = {std::round(ps[i].x * scale) / scale,
+		    std::round(ps[i].y * scale) / scale};
+	return res;
+}
+
+const Painter::Outline &Painter::getOutline(
+    const std::array<Geom::Point, 4> &corners)
+{
+	auto ps = quantize(corners);
+
+	Util::Hash hash;
+	for (const auto &point : ps) hash.add(point.x, point.y);
+	auto key = hash.add(polygonOptions.toCircleFactor,
+	                   polygonOptions.straightFactor)
+	               .get();
+
+	auto matches = [&ps, this](const Outline &outline)
+	{
+		return outline.corners == ps
+		    && outline.options == polygonOptions;
+	};
+
+	if (auto it = outlines.find(key); it != outlines.end()) {
+		if (matches(it->second)) return it->second;
+	}
+	else if (auto prev = previousOutlines.find(key);
+	         prev != previousOutlines.end() && matches(prev->second))
+		return outlines.insert(previousOutlines.extract(prev))
+		    .position->second;
+
+	auto &outline = outlines[key];
+	outline.corners = ps;
+	outline.options = polygonOptions;
+	outline.points.clear();
+	outline.circle = DrawPolygon::sample(ps,
+	    {{pathSampler, system}, polygonOptions},
+	    outline.points);
+	return outline;
+}
+
+std::optional<Geom::Rect> Painter::plainRect(
+    const std::array<Geom::Point, 4> &ps) const
+{
+	if (system.getPolar() != false) return std::nullopt;
+
+	std::array<Geom::Point, 4> converted;
+	for (auto i = 0U; i < ps.size(); ++i)
+		converted[i] = system.convert(ps[i]);
+
+	auto same = [](double a, double b)
+	{
+		return std::abs(a - b) <= 1e-6;
+	};
+	auto &[p0, p1, p2, p3] = converted;
+	if ((same(p0.x, p3.x) && same(p1.x, p2.x) && same(p0.y, p1.y)
+	        && same(p2.y, p3.y))
+	    || (same(p0.x, p1.x) && same(p2.x, p3.x) && same(p0.y, p3.y)
+	        && same(p1.y, p2.y)))
+		return Geom::Rect::Boundary(converted);
+
+	return std::nullopt;
+}
+
+std::optional<Geom::Circle> Painter::plainCircle(
+    const std::array<Geom::Point, 4> &ps) const
+{
+	if (system.getPolar() != false) return std::nullopt;
+
+	auto boundary = Geom::Rect::Boundary(ps).size;
+	auto linSize = Geom::Size{system.verConvert(boundary.x),
+	    system.verConvert(boundary.y)};
+
+	if (!linSize.isSquare(0.005)) return std::nullopt;
+
+	return Geom::Circle{system.convert(Math::mean(ps)),
+	    std::abs(linSize.x) / 2.0};
+}
+
+}
@@ -1,6 +1,14 @@
 #ifndef PAINTER_H
 #define PAINTER_H
 
+#include <array>
+#include <cstddef>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+#include "base/geom/circle.h"
+#include "base/geom/rect.h"
 #include "base/gfx/canvas.h"
 #include "base/gfx/pathsampler.h"
 
@@ -17,10 +25,7 @@ public:
 
 	virtual Gfx::ICanvas &getCanvas() = 0;
 
-	void setCoordSys(const CoordinateSystem &system)
-	{
-		this->system = system;
-	}
+	void setCoordSys(const CoordinateSystem &system);
 
 	void drawLine(const Geom::Line &line);
 
@@ -40,16 +45,37 @@ public:
 	void drawPolygon(const std::array<Geom::Point, 4> &ps,
 	    bool clip = false);
 
+	[[nodiscard]] std::optional<Geom::Rect> plainRect(
+	    const std::array<Geom::Point, 4> &ps) const;
+	[[nodiscard]] std::optional<Geom::Circle> plainCircle(
+	    const std::array<Geom::Point, 4> &ps) const;
+
 	void setPathSamplerOptions(
-	    const Gfx::PathSampler::Options &options)
-	{
-		pathSamplerOptions = options;
-	}
+	    const Gfx::PathSampler::Options &options);
 
 private:
+	struct Outline
+	{
+		std::array<Geom::Point, 4> corners;
+		DrawPolygon::PolygonOptions options;
+		std::optional<Geom::Circle> circle;
+		std::vector<Geom::Point> points;
+	};
+
+	// outline corners are snapped to this fraction of a pixel, so
+	// that jittering markers still hit the outline cache
+	static constexpr double subPixelSteps = 8.0;
+
 	CoordinateSystem system;
-	Gfx::PathSampler::Options pathSamplerOptions{1.0, 0.5};
+	Gfx::PathSampler pathSampler{{1.0, 0.5}};
 	DrawPolygon::PolygonOptions polygonOptions{};
+	std::vector<Geom::Point> points;
+	std::unordered_map<std::size_t, Outline> outlines;
+	std::unordered_map<std::size_t, Outline> previousOutlines;
+
+	[[nodiscard]] std::array<Geom::Point, 4> quantize(
+	    const std::array<Geom::Point, 4> &ps) const;
+	const Outline &getOutline(const std::array<Geom::Point, 4> &ps);
 };
 
 }
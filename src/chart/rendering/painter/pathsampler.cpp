@@ -1,4 +1,3 @@
-
 #include "pathsampler.h"
 
 #include "base/geom/point.h"
@@ -10,10 +9,10 @@ namespace Vizzu::Draw
 PathSampler::PathSampler(const Geom::Point &p0,
     const Geom::Point &p1,
     const Options &options) :
-    Gfx::PathSampler(options),
+    sampler(options.sampler),
     coordSys(options.coordSys),
     p0(p0),
     p1(p1)
 {}
 
-}
\ No newline at end of file
+}
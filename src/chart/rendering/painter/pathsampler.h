@@ -8,11 +8,12 @@
 namespace Vizzu::Draw
 {
 
-class PathSampler : public Gfx::PathSampler
+class PathSampler
 {
 public:
-	struct Options : Gfx::PathSampler::Options
+	struct Options
 	{
+		Gfx::PathSampler &sampler;
 		const CoordinateSystem &coordSys;
 	};
 
@@ -21,6 +22,7 @@ public:
 	    const Options &options);
 
 protected:
+	Gfx::PathSampler &sampler;
 	const CoordinateSystem &coordSys;
 	Geom::Point p0;
 	Geom::Point p1;
@@ -0,0 +1,36 @@
+#ifndef CHART_RENDERING_RENDERCACHE_H
+#define CHART_RENDERING_RENDERCACHE_H
+
+#include <cstddef>
+
+#include "base/gfx/lineargradient.h"
+#include "base/refl/auto_enum.h"
+#include "chart/options/channel.h"
+
+#include "drawaxes.h"
+#include "drawchart.h"
+#include "drawmarkerinfo.h"
+#include "markercache.h"
+#include "ticklabelcache.h"
+
+namespace Vizzu::Draw
+{
+
+// Rendering state of a chart kept between its frames.
+struct RenderCache
+{
+	MarkerCache markers;
+	Refl::EnumArray<Gen::AxisId, TickLabelCache> tickLabels;
+	Refl::EnumArray<Gen::AxisId, DrawAxes::MeasureTicks> measureTicks;
+	DrawAxes::Buffers axes;
+	DrawMarkerInfo::TextCache markerInfoTexts;
+	DrawChart::LayerInputs layers;
+	Gfx::LinearGradient legendFade;
+	// changes whenever the plot is replaced, animated or laid out
+	// again, the layers drawn from the plot are keyed on it
+	std::size_t plotGeneration{};
+};
+
+}
+
+#endif
@@ -1,11 +1,20 @@
 #include "renderedchart.h"
 
 #include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <iterator>
 #include <limits>
+#include <optional>
 #include <ranges>
+#include <utility>
 #include <variant>
+#include <vector>
 
 #include "base/geom/point.h"
+#include "base/geom/rect.h"
 #include "base/geom/transformedrect.h"
 #include "base/math/floating.h"
 #include "base/util/eventdispatcher.h"
@@ -15,15 +24,92 @@
 namespace Vizzu::Draw
 {
 
+namespace
+{
+
+constexpr double MARKER_DISTANCE_THRESHOLD = 0.01;
+constexpr std::size_t MAX_CELLS_PER_MARKER = 64;
+
+bool isFinite(const Geom::Rect &rect)
+{
+	return std::isfinite(rect.left()) && std::isfinite(rect.right())
+	    && std::isfinite(rect.bottom()) && std::isfinite(rect.top());
+}
+
+}
+
+void RenderedChart::reset(const CoordinateSystem &coordinateSystem,
+    std::shared_ptr<const Gen::Plot> plot)
+{
+	previousElements.clear();
+	std::swap(previousElements, elements);
+	previousLayers.clear();
+	std::swap(previousLayers, layers);
+	hitIndex.reset();
+	this->coordinateSystem = coordinateSystem;
+	this->plot = std::move(plot);
+}
+
+bool RenderedChart::hasLayer(std::size_t id, std::size_t key) const
+{
+	return std::ranges::any_of(previousLayers,
+	    [id, key](const LayerRange &layer)
+	    {
+		    return layer.id == id && layer.key == key;
+	    });
+}
+
+void RenderedChart::reuseLayer(std::size_t id, std::size_t key)
+{
+	auto it = std::ranges::find_if(previousLayers,
+	    [id, key](const LayerRange &layer)
+	    {
+		    return layer.id == id && layer.key == key;
+	    });
+	if (it == previousLayers.end()) return;
+
+	auto begin = elements.size();
+	std::move(std::next(previousElements.begin(),
+	              static_cast<std::ptrdiff_t>(it->begin)),
+	    std::next(previousElements.begin(),
+	        static_cast<std::ptrdiff_t>(it->end)),
+	    std::back_inserter(elements));
+	layers.push_back({id, key, begin, elements.size()});
+	hitIndex.reset();
+}
+
+void RenderedChart::beginLayer(std::size_t id, std::size_t key)
+{
+	layers.push_back({id, key, elements.size(), elements.size()});
+}
+
+void RenderedChart::endLayer() { layers.back().end = elements.size(); }
+
 const Util::EventTarget *RenderedChart::find(
     const Geom::Point &point) const
 {
 	auto original = coordinateSystem.getOriginal(point);
 
+	const auto &index = getHitIndex();
+	candidates = index.unindexed;
+	if (!index.cells.empty() && index.bounds.contains(original)) {
+		auto &&cell =
+		    index.cells[index.cellOf(original.y,
+		                    index.bounds.bottom(),
+		                    index.bounds.height())
+		                    * index.size
+		                + index.cellOf(original.x,
+		                    index.bounds.left(),
+		                    index.bounds.width())];
+		candidates.insert(candidates.end(), cell.begin(), cell.end());
+	}
+	std::ranges::sort(candidates, std::ranges::greater{});
+
 	const Util::EventTarget *closestMarker{};
 	double closestMarkerDistance = std::numeric_limits<double>::max();
 
-	for (const auto &element : std::ranges::reverse_view(elements)) {
+	for (auto ix : candidates) {
+		const auto &element = elements[ix];
 		if (const auto *rect = std::get_if<Geom::TransformedRect>(
 		        &element.geometry)) {
 			if (rect->contains(point)) return element.target.get();
@@ -42,7 +128,6 @@ const Util::EventTarget *RenderedChart::find(
 		}
 		else if (const auto *marker =
 		             std::get_if<Marker>(&element.geometry)) {
-			constexpr double MARKER_DISTANCE_THRESHOLD = 0.01;
 			if (const auto dist =
 			        marker->distance(coordinateSystem, original);
 			    dist < MARKER_DISTANCE_THRESHOLD
@@ -56,6 +141,76 @@ const Util::EventTarget *RenderedChart::find(
 	return closestMarker;
 }
 
+std::size_t RenderedChart::HitIndex::cellOf(double pos,
+    double min,
+    double length) const
+{
+	if (!(length > 0.0)) return 0;
+	auto cell = std::floor((pos - min) / length
+	                       * static_cast<double>(size));
+	return std::min(static_cast<std::size_t>(std::max(cell, 0.0)),
+	    size - 1);
+}
+
+const RenderedChart::HitIndex &RenderedChart::getHitIndex() const
+{
+	if (hitIndex) return *hitIndex;
+
+	auto &index = hitIndex.emplace();
+
+	std::vector<std::pair<std::size_t, Geom::Rect>> boxes;
+	for (std::size_t ix{}; ix < elements.size(); ++ix) {
+		const auto *marker =
+		    std::get_if<Marker>(&elements[ix].geometry);
+		if (!marker) {
+			index.unindexed.push_back(ix);
+			continue;
+		}
+		if (!marker->enabled) continue;
+
+		if (auto box = marker->bounds(coordinateSystem,
+		        MARKER_DISTANCE_THRESHOLD);
+		    box && isFinite(*box))
+			boxes.emplace_back(ix, *box);
+		else
+			index.unindexed.push_back(ix);
+	}
+	if (boxes.empty()) return index;
+
+	index.bounds = boxes.front().second;
+	for (const auto &box : boxes)
+		index.bounds = index.bounds.boundary(box.second);
+
+	index.size = static_cast<std::size_t>(
+	    std::ceil(std::sqrt(static_cast<double>(boxes.size()))));
+	index.cells.resize(index.size * index.size);
+
+	for (const auto &[ix, box] : boxes) {
+		auto &&bounds = index.bounds;
+		auto x0 = index.cellOf(box.left(),
+		    bounds.left(),
+		    bounds.width());
+		auto x1 = index.cellOf(box.right(),
+		    bounds.left(),
+		    bounds.width());
+		auto y0 = index.cellOf(box.bottom(),
+		    bounds.bottom(),
+		    bounds.height());
+		auto y1 = index.cellOf(box.top(),
+		    bounds.bottom(),
+		    bounds.height());
+
+		if ((x1 - x0 + 1) * (y1 - y0 + 1) > MAX_CELLS_PER_MARKER) {
+			index.unindexed.push_back(ix);
+			continue;
+		}
+		for (auto y = y0; y <= y1; ++y)
+			for (auto x = x0; x <= x1; ++x)
+				index.cells[y * index.size + x].push_back(ix);
+	}
+	return index;
+}
+
 double Marker::distance(const CoordinateSystem &coordSys,
     const Geom::Point &point) const
 {
@@ -89,6 +244,43 @@ double Marker::distance(const CoordinateSystem &coordSys,
 	    });
 }
 
+std::optional<Geom::Rect> Marker::bounds(
+    const CoordinateSystem &coordSys,
+    double maxDistance) const
+{
+	std::optional<Geom::Rect> res;
+	bool bounded = true;
+	shapeType.visit(
+	    [&](::Anim::InterpolateIndex, const auto &shape)
+	    {
+		    Geom::Rect box;
+		    if (shape.value != Gen::ShapeType::line)
+			    box = Geom::Rect::Boundary(points).outline(
+			        {maxDistance, maxDistance});
+		    else if (coordSys.getPolar() == false) {
+			    auto rel_to_px = coordSys.getRect().size.minSize();
+			    auto margin = maxDistance
+			                * (Math::Floating::is_zero(rel_to_px)
+			                        ? 1.0
+			                        : rel_to_px);
+			    auto corners =
+			        Geom::Rect::Boundary(lineToQuad(coordSys).points)
+			            .outline({margin, margin})
+			            .points();
+			    for (auto &corner : corners)
+				    corner = coordSys.getOriginal(corner);
+			    box = Geom::Rect::Boundary(corners);
+		    }
+		    else {
+			    bounded = false;
+			    return;
+		    }
+		    res = res ? res->boundary(box) : box;
+	    });
+	if (!bounded) return std::nullopt;
+	return res;
+}
+
 Geom::ConvexQuad Marker::lineToQuad(
     const CoordinateSystem &coordSys) const
 {
@@ -1,7 +1,9 @@
 #ifndef CHART_RENDERING_RENDEREDCHART_H
 #define CHART_RENDERING_RENDEREDCHART_H
 
+#include <cstddef>
 #include <memory>
+#include <optional>
 #include <variant>
 #include <vector>
 
@@ -11,6 +13,7 @@
 #include "base/geom/quadrilateral.h"
 #include "base/geom/transformedrect.h"
 #include "base/util/eventdispatcher.h"
+#include "base/util/objectpool.h"
 #include "chart/generator/plotptr.h"
 #include "chart/options/shapetype.h"
 #include "chart/rendering/painter/coordinatesystem.h"
@@ -43,6 +46,10 @@ public:
 	[[nodiscard]] double distance(const CoordinateSystem &coordSys,
 	    const Geom::Point &point) const;
 
+	[[nodiscard]] std::optional<Geom::Rect> bounds(
+	    const CoordinateSystem &coordSys,
+	    double maxDistance) const;
+
 private:
 	[[nodiscard]] Geom::ConvexQuad lineToQuad(
 	    const CoordinateSystem &coordSys) const;
@@ -50,6 +57,8 @@ private:
 	[[nodiscard]] Geom::Line getLine() const;
 };
 
+using EventTargetPtr = Util::ObjectPool::Ptr<Util::EventTarget>;
+
 class DrawingElement
 {
 public:
@@ -57,14 +66,13 @@ public:
 	    std::variant<Geom::TransformedRect, Line, Rect, Marker>;
 
 	template <class T>
-	DrawingElement(const T &geometry,
-	    std::unique_ptr<Util::EventTarget> target) :
+	DrawingElement(const T &geometry, EventTargetPtr target) :
 	    geometry(geometry),
 	    target(std::move(target))
 	{}
 
 	Geometry geometry;
-	std::unique_ptr<Util::EventTarget> target;
+	EventTargetPtr target;
 };
 
 class RenderedChart
@@ -77,11 +85,25 @@ public:
 	    plot(std::move(plot))
 	{}
 
+	void reset(const CoordinateSystem &coordinateSystem,
+	    std::shared_ptr<const Gen::Plot> plot);
+
+	[[nodiscard]] Util::ObjectPool &getTargetPool()
+	{
+		return *targetPool;
+	}
+
 	template <typename... T> void emplace(T &&...args)
 	{
 		elements.emplace_back(std::forward<T>(args)...);
+		hitIndex.reset();
 	}
 
+	[[nodiscard]] bool hasLayer(std::size_t id, std::size_t key) const;
+	void reuseLayer(std::size_t id, std::size_t key);
+	void beginLayer(std::size_t id, std::size_t key);
+	void endLayer();
+
 	[[nodiscard]] const Util::EventTarget *find(
 	    const Geom::Point &point) const;
 
@@ -93,7 +115,38 @@ public:
 private:
 	CoordinateSystem coordinateSystem;
 	std::shared_ptr<const Gen::Plot> plot;
+	std::unique_ptr<Util::ObjectPool> targetPool{
+	    std::make_unique<Util::ObjectPool>()};
 	std::vector<DrawingElement> elements;
+	std::vector<DrawingElement> previousElements;
+
+	struct LayerRange
+	{
+		std::size_t id;
+		std::size_t key;
+		std::size_t begin;
+		std::size_t end;
+	};
+
+	std::vector<LayerRange> layers;
+	std::vector<LayerRange> previousLayers;
+
+	struct HitIndex
+	{
+		Geom::Rect bounds;
+		std::size_t size{};
+		std::vector<std::vector<std::size_t>> cells;
+		std::vector<std::size_t> unindexed;
+
+		[[nodiscard]] std::size_t cellOf(double pos,
+		    double min,
+		    double length) const;
+	};
+
+	mutable std::optional<HitIndex> hitIndex;
+	mutable std::vector<std::size_t> candidates;
+
+	[[nodiscard]] const HitIndex &getHitIndex() const;
 };
 
 }
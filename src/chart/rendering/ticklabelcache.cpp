@@ -0,0 +1,44 @@
+#include "ticklabelcache.h"
+
+#include <cstddef>
+#include <string>
+
+#include "base/text/numberscale.h"
+#include "base/text/smartstring.h"
+
+namespace Vizzu::Draw
+{
+
+const std::string &TickLabelCache::get(double value,
+    Text::NumberFormat format,
+    std::size_t maxFractionDigits,
+    const Text::NumberScale &numberScale,
+    const std::string &unit)
+{
+	if (format != this->format
+	    || maxFractionDigits != this->maxFractionDigits
+	    || numberScale != this->numberScale || size >= maxSize) {
+		this->format = format;
+		this->maxFractionDigits = maxFractionDigits;
+		this->numberScale = numberScale;
+		labels.clear();
+		size = 0;
+	}
+
+	auto unitIt = labels.find(unit);
+	if (unitIt == labels.end())
+		unitIt = labels.try_emplace(unit).first;
+
+	auto [it, inserted] = unitIt->second.try_emplace(value);
+	if (inserted) {
+		it->second = Text::SmartString::fromPhysicalValue(value,
+		    format,
+		    maxFractionDigits,
+		    numberScale,
+		    unit);
+		++size;
+	}
+	return it->second;
+}
+
+}
@@ -0,0 +1,42 @@
+#ifndef CHART_RENDERING_TICKLABELCACHE_H
+#define CHART_RENDERING_TICKLABELCACHE_H
+
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <string>
+#include <unordered_map>
+
+#include "base/text/numberscale.h"
+#include "base/text/smartstring.h"
+
+namespace Vizzu::Draw
+{
+
+// Formatted tick labels of an axis, the ticks recur between the
+// frames even while the axis range is animated.
+class TickLabelCache
+{
+public:
+	const std::string &get(double value,
+	    Text::NumberFormat format,
+	    std::size_t maxFractionDigits,
+	    const Text::NumberScale &numberScale,
+	    const std::string &unit);
+
+private:
+	static constexpr std::size_t maxSize = 256;
+
+	Text::NumberFormat format{};
+	std::size_t maxFractionDigits{};
+	Text::NumberScale numberScale;
+	std::size_t size{};
+	std::map<std::string,
+	    std::unordered_map<double, std::string>,
+	    std::less<>>
+	    labels;
+};
+
+}
+
+#endif
@@ -0,0 +1,58 @@
+#include "tilebins.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "base/geom/rect.h"
+#include "base/gfx/canvas.h"
+
+namespace Vizzu::Draw
+{
+
+TileBins::TileBins(const Gfx::ICanvas::TileGrid &grid) :
+    grid(grid),
+    area{grid.origin,
+        {grid.tileSize.x * static_cast<double>(grid.columns),
+            grid.tileSize.y * static_cast<double>(grid.rows)}},
+    bins(grid.columns * grid.rows)
+{}
+
+void TileBins::add(std::uint32_t index,
+    const Geom::Rect &bounds,
+    double margin)
+{
+	auto left = bounds.left() - margin;
+	auto right = bounds.right() + margin;
+	auto bottom = bounds.bottom() - margin;
+	auto top = bounds.top() + margin;
+	if (!(right >= area.left() && left <= area.right()
+	        && top >= area.bottom() && bottom <= area.top()))
+		return;
+
+	const auto &[origin, size, columns, rows] = grid;
+	auto [x0, x1] =
+	    cells(left - origin.x, right - origin.x, size.x, columns);
+	auto [y0, y1] =
+	    cells(bottom - origin.y, top - origin.y, size.y, rows);
+	for (auto y = y0; y < y1; ++y)
+		for (auto x = x0; x < x1; ++x)
+			bins[y * columns + x].push_back(index);
+}
+
+std::pair<std::size_t, std::size_t> TileBins::cells(double begin,
+    double end,
+    double size,
+    std::size_t count)
+{
+	auto last = static_cast<double>(count - 1);
+	return {static_cast<std::size_t>(
+	            std::clamp(std::floor(begin / size), 0.0, last)),
+	    static_cast<std::size_t>(
+	        std::clamp(std::floor(end / size), 0.0, last))
+	        + 1};
+}
+
+}
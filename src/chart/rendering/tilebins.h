@@ -0,0 +1,47 @@
+#ifndef CHART_RENDERING_TILEBINS_H
+#define CHART_RENDERING_TILEBINS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "base/geom/rect.h"
+#include "base/gfx/canvas.h"
+
+namespace Vizzu::Draw
+{
+
+// Shapes binned into the tiles of a canvas. Each tile lists the
+// indices of the shapes whose bounds, extended by a margin for the
+// border and anti-aliasing, overlap it, in the order of addition.
+class TileBins
+{
+public:
+	explicit TileBins(const Gfx::ICanvas::TileGrid &grid);
+
+	void add(std::uint32_t index,
+	    const Geom::Rect &bounds,
+	    double margin);
+
+	[[nodiscard]] std::span<const std::uint32_t> operator[](
+	    std::size_t tile) const
+	{
+		return bins[tile];
+	}
+
+	// half-open range of the cells covering [begin, end] of an axis
+	// split to count cells of the given size, clamped to the grid
+	[[nodiscard]] static std::pair<std::size_t, std::size_t>
+	cells(double begin, double end, double size, std::size_t count);
+
+private:
+	Gfx::ICanvas::TileGrid grid;
+	Geom::Rect area;
+	std::vector<std::vector<std::uint32_t>> bins;
+};
+
+}
+
+#endif
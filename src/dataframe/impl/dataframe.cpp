@@ -1,6 +1,7 @@
 #include "dataframe.h"
 
 #include <algorithm>
+#include <atomic>
 #include <cmath>
 #include <compare>
 #include <cstddef>
@@ -57,6 +58,31 @@ std::shared_ptr<dataframe_interface> dataframe::copy(
 	        : nullptr);
 }
 
+dataframe dataframe::snapshot() const &
+{
+	// an owned source is shared, the first modification of either
+	// side copies it
+	if (const auto *owned = get_if<source_type::owning>(&source)) {
+		dataframe res;
+		res.source = *owned;
+		return res;
+	}
+
+	const auto *&&cp = get_if<source_type::copying>(&source);
+	std::optional<std::vector<bool>> filtered;
+	std::optional<std::vector<std::size_t>> sorted;
+	if (cp) {
+		filtered = cp->pre_remove;
+		sorted = cp->sorted_indices;
+	}
+	dataframe res;
+	res.source = std::make_shared<data_source>(
+	    cp ? cp->other : unsafe_get<source_type::owning>(source),
+	    std::move(filtered),
+	    std::move(sorted));
+	return res;
+}
+
 std::shared_ptr<dataframe_interface> dataframe::create_new()
 {
 	return create_interface();
@@ -775,10 +801,25 @@ void dataframe::migrate_data()
 	}
 }
 
+void dataframe::detach_source()
+{
+	auto *owned = get_if<source_type::owning>(&source);
+	if (!owned) return;
+	if (owned->use_count() > 1)
+		*owned = std::make_shared<data_source>(*owned,
+		    std::nullopt,
+		    std::nullopt);
+	else
+		// the reads of the last other owner, e.g. on a worker
+		// thread, happen before the release of its reference
+		std::atomic_thread_fence(std::memory_order_acquire);
+}
+
 void dataframe::change_state_to(state_type new_state,
     state_modification_reason reason)
 {
 	using reason_t = state_modification_reason;
+	if (reason == reason_t::needs_own_state) detach_source();
 	if (state_data == new_state) return;
 
 	switch (state_data) {
@@ -787,8 +828,10 @@ void dataframe::change_state_to(state_type new_state,
 		if (reason == reason_t::needs_series_type
 		    || reason == reason_t::needs_sorted_records)
 			return;
-		if (auto *owned = get_if<source_type::owning>(&source))
+		if (auto *owned = get_if<source_type::owning>(&source)) {
+			detach_source();
 			(*owned)->normalize_sizes();
+		}
 		break;
 	case aggregating: migrate_data(); break;
 	case sorting:
@@ -803,6 +846,7 @@ void dataframe::change_state_to(state_type new_state,
 				ptr->sorted_indices = std::move(indices);
 		}
 		else {
+			detach_source();
 			auto &owning = *unsafe_get<source_type::owning>(source);
 			if (auto &&indices = owning.get_sorted_indices(
 			        std::exchange(unsafe_get<sorting>(state_data),
@@ -837,8 +881,10 @@ void dataframe::change_state_to(state_type new_state,
 		state_data.emplace<sorting>();
 		break;
 	case finalized: {
-		if (auto *ptr = get_if<source_type::owning>(&source))
+		if (auto *ptr = get_if<source_type::owning>(&source)) {
+			detach_source();
 			(*ptr)->finalize();
+		}
 		state_data.emplace<finalized>();
 		break;
 	}
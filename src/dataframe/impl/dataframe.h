@@ -50,6 +50,8 @@ public:
 	[[nodiscard]] std::shared_ptr<dataframe_interface> copy(
 	    bool inherit_sorting) const &;
 
+	[[nodiscard]] dataframe snapshot() const &;
+
 	[[nodiscard]] static std::shared_ptr<dataframe_interface>
 	create_new();
 
@@ -144,6 +146,9 @@ public:
 	[[nodiscard]] std::string get_record_id(std::size_t my_record) &;
 
 private:
+	// gives the owned data source a copy of its own if it is shared
+	// with a snapshot or a copy, so that they are not modified
+	void detach_source();
 	void migrate_data();
 	void change_state_to(state_type new_state,
 	    state_modification_reason reason);
@@ -0,0 +1,195 @@
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdlib>
+#include <functional>
+#include <new>
+#include <string>
+
+#include "base/geom/rect.h"
+#include "base/gfx/canvas.h"
+#include "chart/main/chart.h"
+#include "chart/main/events.h"
+#include "chart/rendering/painter/painter.h"
+#include "chart/rendering/renderedchart.h"
+
+#include "../unit/util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+
+namespace
+{
+
+std::atomic<std::size_t> allocations{};
+
+void *allocate(std::size_t size, std::size_t alignment)
+{
+	++allocations;
+	size = (size + alignment - 1) / alignment * alignment;
+	if (void *res = std::aligned_alloc(alignment, size)) return res;
+	throw std::bad_alloc{};
+}
+
+}
+
+void *operator new(std::size_t size)
+{
+	return allocate(size, alignof(std::max_align_t));
+}
+
+void *operator new(std::size_t size, std::align_val_t alignment)
+{
+	return allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *ptr) noexcept { std::free(ptr); }
+
+void operator delete(void *ptr, std::size_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr, std::align_val_t) noexcept
+{
+	std::free(ptr);
+}
+
+void operator delete(void *ptr,
+    std::size_t,
+    std::align_val_t) noexcept
+{
+	std::free(ptr);
+}
+
+Geom::Size Gfx::ICanvas::measureText(const Font &font,
+    const std::string &text)
+{
+	return {static_cast<double>(text.size()) * font.size / 2.0,
+	    font.size};
+}
+
+namespace
+{
+
+struct NullCanvas final : Gfx::ICanvas, Vizzu::Draw::Painter
+{
+	void setClipRect(const Geom::Rect &) final {}
+	void setClipCircle(const Geom::Circle &) final {}
+	void setClipPolygon() final {}
+	void setBrushColor(const Gfx::Color &) final {}
+	void setLineColor(const Gfx::Color &) final {}
+	void setLineWidth(double) final {}
+	void setFont(const Gfx::Font &) final {}
+	void transform(const Geom::AffineTransform &) final {}
+	void save() final {}
+	void restore() final {}
+	void beginDropShadow() final {}
+	void setDropShadowBlur(double) final {}
+	void setDropShadowColor(const Gfx::Color &) final {}
+	void setDropShadowOffset(const Geom::Point &) final {}
+	void endDropShadow() final {}
+	void beginPolygon() final { ++shapes; }
+	void addPoint(const Geom::Point &) final {}
+	void addBezier(const Geom::Point &,
+	    const Geom::Point &,
+	    const Geom::Point &) final
+	{}
+	void endPolygon() final {}
+	void rectangle(const Geom::Rect &) final { ++shapes; }
+	void circle(const Geom::Circle &) final { ++shapes; }
+	void line(const Geom::Line &) final {}
+	void text(const Geom::Rect &, const std::string &) final {}
+	void setBrushGradient(const Gfx::LinearGradient &) final {}
+	void frameBegin() final {}
+	void frameEnd() final {}
+	void *getPainter() final { return static_cast<Painter *>(this); }
+	// cppcheck-suppress duplInheritedMember
+	ICanvas &getCanvas() final { return *this; }
+
+	std::size_t shapes{};
+};
+
+void drawFrame(Vizzu::Draw::RenderedChart &chart,
+    const std::string &label)
+{
+	using Vizzu::Events;
+	using Vizzu::Gen::AxisId;
+
+	chart.reset(Vizzu::Draw::CoordinateSystem{
+	                Geom::Rect{{0.0, 0.0}, {1.0, 1.0}}},
+	    {});
+	auto &pool = chart.getTargetPool();
+	for (std::size_t ix{}; ix < 1000; ++ix) {
+		chart.emplace(Vizzu::Draw::Line{{}, true},
+		    Events::Targets::axisTick(pool, AxisId::x));
+		chart.emplace(Geom::TransformedRect{},
+		    Events::Targets::dimAxisLabel(pool,
+		        "a category name longer than the small buffer",
+		        label,
+		        AxisId::y));
+	}
+}
+
+void setup(Vizzu::Chart &chart)
+{
+	auto &table = chart.getTable();
+	table.add_dimension({{"A", "B", "C", "D", "E"}},
+	    {{0, 0, 0, 0, 1, 1, 1, 1, 2, 2, 2, 2, 3, 3, 3, 4}},
+	    "Dim5");
+	table.add_dimension({{"a", "b"}},
+	    {{0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1}},
+	    "Dim2");
+	table.add_measure(
+	    {{1, 2, 4, 3, 3, 4, 2, 1, 4, 3, 1, 2, 2, 1, 3, 4}},
+	    "Meas1");
+
+	auto &channels = chart.getOptions().getChannels();
+	using Vizzu::Gen::ChannelId;
+	channels.at(ChannelId::x).addSeries({"Dim5", std::ref(table)});
+	channels.at(ChannelId::y).addSeries({"Meas1", std::ref(table)});
+	channels.at(ChannelId::color).addSeries(
+	    {"Dim2", std::ref(table)});
+	channels.at(ChannelId::label).addSeries(
+	    {"Meas1", std::ref(table)});
+
+	chart.setBoundRect(Geom::Rect(Geom::Point{}, {{640, 480}}));
+	chart.getAnimOptions().control.position = 1.0;
+	chart.setKeyframe();
+	chart.animate({});
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	chart.setBoundRect(chart.getLayout().boundary);
+}
+
+}
+
+const static auto tests =
+    "Allocations"_suite
+
+    | "steady state rendered chart does not allocate" | []
+{
+	const std::string label =
+	    "a category value longer than the small buffer";
+	Vizzu::Draw::RenderedChart chart;
+	drawFrame(chart, label);
+	drawFrame(chart, label);
+
+	auto before = allocations.load();
+	drawFrame(chart, label);
+	check->*(allocations.load() - before) == 0u;
+}
+
+    | "unchanged chart frame does not allocate" | []
+{
+	Vizzu::Chart chart;
+	setup(chart);
+	NullCanvas canvas;
+	for (auto i = 0; i < 3; ++i) chart.draw(canvas);
+
+	canvas.shapes = 0;
+	auto before = allocations.load();
+	chart.draw(canvas);
+	check->*(allocations.load() - before) == 0u;
+	check->*(canvas.shapes >= 10) == "markers are drawn"_is_true;
+};
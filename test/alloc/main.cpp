@@ -0,0 +1,6 @@
+#include "../unit/util/test.h"
+
+int main(int argc, char *argv[])
+{
+	return test::application({argv + 1, argv + argc}).run();
+}
@@ -1,6 +1,10 @@
 #include "base/conv/numtostr.h"
 
+#include <array>
 #include <cmath>
+#include <cstddef>
+#include <cstdio>
+#include <string>
 
 #include "../../util/test.h"
 
@@ -199,4 +203,66 @@ const static auto tests =
 	                   "184,124,858,368.000'000'000";
             })
 
+        .add_case("NumberToString 100k tick values match printf",
+            []
+            {
+	            NumberToString converter;
+	            converter.fractionDigitCount = 6;
+	            converter.fillFractionWithZero = true;
+
+	            std::array<char, 400> buffer{};
+	            std::size_t mismatches{};
+	            auto compare = [&](double value)
+	            {
+		            auto size = std::snprintf(buffer.data(),
+		                buffer.size(),
+		                "%.*f",
+		                converter.fractionDigitCount,
+		                value);
+		            mismatches += converter(value)
+		                       != std::string(buffer.data(),
+		                           static_cast<std::size_t>(size));
+	            };
+
+	            for (std::size_t ix{1}; ix <= 100000; ++ix) {
+		            auto sign = ix % 2 == 0 ? 1.0 : -1.0;
+		            compare(static_cast<double>(ix) * 0.25 * sign);
+		            compare(static_cast<double>(ix) * 0.1 * sign);
+	            }
+	            check() << mismatches == 0U;
+
+	            converter.fractionDigitCount = 2;
+	            for (auto exp = 10; exp <= 300; exp += 10) {
+		            compare(1.2345 * std::pow(10.0, exp));
+		            compare(-std::pow(10.0, exp));
+	            }
+	            check() << mismatches == 0U;
+            })
+
+        .add_case("NumberToString halfway values",
+            []
+            {
+	            NumberToString converter;
+	            converter.fillFractionWithZero = true;
+
+	            // just below the half rounds up, unlike printf
+
+	            converter.fractionDigitCount = 1;
+	            check() << converter(0.25) == "0.3";
+	            check() << converter(2.15) == "2.2";
+	            check() << converter(-0.25) == "-0.2";
+
+	            converter.fractionDigitCount = 2;
+	            check() << converter(0.125) == "0.13";
+	            check() << converter(0.015) == "0.02";
+	            check() << converter(0.295) == "0.30";
+	            check() << converter(0.625) == "0.63";
+
+	            // exact halves of integers round to even as in printf
+	            converter.fractionDigitCount = 0;
+	            check() << converter(0.5) == "0";
+	            check() << converter(1.5) == "2";
+	            check() << converter(2.5) == "2";
+            })
+
     ;
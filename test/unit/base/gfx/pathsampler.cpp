@@ -0,0 +1,72 @@
+#include "base/gfx/pathsampler.h"
+
+#include <cmath>
+#include <numbers>
+#include <vector>
+
+#include "base/geom/point.h"
+
+#include "../../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+
+namespace
+{
+
+Geom::Point arc(double f)
+{
+	return Geom::Point::Polar(100.0, f * 1.5 * std::numbers::pi);
+}
+
+}
+
+const static auto tests =
+    "Gfx::PathSampler"_suite
+
+    | "straight path is not subdivided" | []
+{
+	Gfx::PathSampler sampler{{1.0, 0.5}};
+	std::vector<Geom::Point> points;
+	sampler.sample(
+	    [](double f)
+	    {
+		    return Geom::Point{f * 100.0, f * 50.0};
+	    },
+	    points);
+
+	check->*points.size() == 3u;
+	check->*(points.front() == Geom::Point{0.0, 0.0})
+	    == "starts at the beginning"_is_true;
+	check->*(points[1] == Geom::Point{50.0, 25.0})
+	    == "midpoint sampled"_is_true;
+	check->*(points.back() == Geom::Point{100.0, 50.0})
+	    == "ends at the end"_is_true;
+}
+
+    | "curved path is sampled in order within tolerance" | []
+{
+	Gfx::PathSampler sampler{{1.0, 0.5}};
+	std::vector<Geom::Point> points{Geom::Point{-1.0, -1.0}};
+	sampler.sample(arc, points);
+
+	check->*(points.front() == Geom::Point{-1.0, -1.0})
+	    == "appends to the buffer"_is_true;
+	check->*(points.size() > 20u) == "curve subdivided"_is_true;
+
+	auto ordered = true;
+	auto onArc = true;
+	for (auto i = 2U; i < points.size(); ++i) {
+		ordered &= points[i - 1].angle() < points[i].angle()
+		        || points[i].angle() < 0;
+		onArc &= std::abs(points[i].abs() - 100.0) < 1e-9;
+	}
+	check->*ordered == "points follow the path"_is_true;
+	check->*onArc == "points lie on the path"_is_true;
+
+	const auto count = points.size();
+	points.clear();
+	sampler.sample(arc, points);
+	check->*points.size() == count - 1;
+};
@@ -0,0 +1,250 @@
+#include "base/gfx/rastercanvas.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdlib>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "../../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+using test::operator""_is_false;
+
+namespace
+{
+
+struct Canvas final : Gfx::RasterCanvas
+{
+	Canvas() : RasterCanvas(40, 30) { frameBegin(); }
+	void *getPainter() final { return nullptr; }
+};
+
+bool near(double value, double expected)
+{
+	return std::abs(value - expected) < 0.02;
+}
+
+void drawCircles(Gfx::ICanvas &canvas,
+    const std::vector<Geom::Circle> &circles)
+{
+	std::vector<Gfx::Color> brushColors;
+	std::vector<Gfx::Color> lineColors;
+	for (auto i = 0U; i < circles.size(); ++i) {
+		brushColors.emplace_back(i % 3 / 2.0, 0.5, 1.0, 0.7);
+		lineColors.emplace_back(0.0, 0.0, 0.0, 0.5);
+	}
+	canvas.circles(circles, brushColors, lineColors);
+}
+
+void drawScene(Canvas &canvas)
+{
+	canvas.setLineWidth(0);
+	canvas.setBrushColor(Gfx::Color{0.2, 0.4, 0.6, 1.0});
+	canvas.circle(Geom::Circle{{20, 15}, 10});
+	canvas.setLineWidth(1.5);
+	canvas.setLineColor(Gfx::Color{1, 0, 0, 0.5});
+	canvas.beginPolygon();
+	canvas.addPoint({2, 2});
+	canvas.addBezier({30, 0}, {40, 20}, {20, 28});
+	canvas.endPolygon();
+	canvas.text(Geom::Rect{{5, 5}, {30, 10}}, "Hi!");
+}
+
+}
+
+const static auto tests =
+    "Gfx::RasterCanvas"_suite
+
+    | "fills anti-aliased rectangles" | []
+{
+	Canvas canvas;
+	canvas.setLineWidth(0);
+	canvas.setBrushColor(Gfx::Color{1, 0, 0, 1});
+	canvas.rectangle(Geom::Rect{{10.5, 5}, {10, 10}});
+
+	check->*(canvas.getPixel(15, 10) == Gfx::Color{1, 0, 0, 1})
+	    == "inside is filled"_is_true;
+	check->*canvas.getPixel(5, 10).alpha == 0.0;
+	check->*near(canvas.getPixel(10, 10).alpha, 0.5)
+	    == "edge is half covered"_is_true;
+	check->*near(canvas.getPixel(20, 10).alpha, 0.5)
+	    == "far edge is half covered"_is_true;
+}
+
+    | "clips and transforms" | []
+{
+	Canvas canvas;
+	canvas.setLineWidth(0);
+	canvas.setBrushColor(Gfx::Color{0, 0, 1, 1});
+	canvas.save();
+	canvas.transform(Geom::AffineTransform{Geom::Point{10, 0}});
+	canvas.setClipRect(Geom::Rect{{0, 0}, {10, 30}});
+	canvas.rectangle(Geom::Rect{{-10, 0}, {40, 30}});
+	canvas.restore();
+
+	check->*canvas.getPixel(9, 10).alpha == 0.0;
+	check->*canvas.getPixel(15, 10).alpha == 1.0;
+	check->*canvas.getPixel(25, 10).alpha == 0.0;
+
+	canvas.rectangle(Geom::Rect{{30, 0}, {10, 30}});
+	check->*canvas.getPixel(35, 10).alpha == 1.0;
+}
+
+    | "strokes lines with the line color" | []
+{
+	Canvas canvas;
+	canvas.setLineWidth(2);
+	canvas.setLineColor(Gfx::Color{0, 1, 0, 1});
+	canvas.line(Geom::Line{{0, 10}, {40, 10}});
+
+	check->*(canvas.getPixel(20, 9) == Gfx::Color{0, 1, 0, 1})
+	    == "line is drawn"_is_true;
+	check->*canvas.getPixel(20, 12).alpha == 0.0;
+
+	canvas.setLineWidth(0);
+	canvas.line(Geom::Line{{0, 20}, {40, 20}});
+	check->*canvas.getPixel(20, 20).alpha == 0.0;
+}
+
+    | "blends and fills gradients" | []
+{
+	Canvas canvas;
+	canvas.setLineWidth(0);
+	canvas.setBrushGradient(Gfx::LinearGradient{{{0, 0}, {40, 0}},
+	    Gfx::ColorGradient{{{0.0, Gfx::Color{1, 0, 0, 1}},
+	        {1.0, Gfx::Color{0, 0, 1, 1}}}}});
+	canvas.rectangle(Geom::Rect{{0, 0}, {40, 30}});
+
+	check->*(canvas.getPixel(0, 5).red > 0.9)
+	    == "starts red"_is_true;
+	check->*(canvas.getPixel(39, 5).blue > 0.9)
+	    == "ends blue"_is_true;
+
+	canvas.setBrushColor(Gfx::Color{1, 1, 1, 0.5});
+	canvas.rectangle(Geom::Rect{{0, 0}, {40, 30}});
+	check->*near(canvas.getPixel(39, 5).red, 0.5)
+	    == "blended over"_is_true;
+	check->*canvas.getPixel(39, 5).alpha == 1.0;
+}
+
+    | "draws bitmap text" | []
+{
+	Canvas canvas;
+	canvas.setFont(Gfx::Font{10});
+	canvas.setBrushColor(Gfx::Color{0, 0, 0, 1});
+	canvas.text(Geom::Rect{{0, 0}, {10, 10}}, "I");
+
+	check->*canvas.getPixel(2, 2).alpha == 1.0;
+	check->*canvas.getPixel(0, 2).alpha == 0.0;
+	check->*canvas.getPixel(2, 9).alpha == 0.0;
+
+	auto size = Gfx::RasterCanvas::textSize(Gfx::Font{10}, "ab€");
+	check->*size.x == 18.0;
+	check->*size.y == 10.0;
+}
+
+    | "renders independently on several threads" | []
+{
+	Canvas reference;
+	drawScene(reference);
+
+	Canvas first;
+	Canvas second;
+	std::thread thread0{[&first]
+	    {
+		    drawScene(first);
+	    }};
+	std::thread thread1{[&second]
+	    {
+		    drawScene(second);
+	    }};
+	thread0.join();
+	thread1.join();
+
+	check->*(first.getPixels() == reference.getPixels())
+	    == "first matches"_is_true;
+	check->*(second.getPixels() == reference.getPixels())
+	    == "second matches"_is_true;
+}
+
+    | "tiled drawing matches direct drawing" | []
+{
+	std::vector<Geom::Circle> circles;
+	for (auto i = 0U; i < 24; ++i)
+		circles.emplace_back(Geom::Point{i * 1.7, i % 5 * 6.3},
+		    3.0 + i % 4);
+
+	Canvas reference;
+	reference.setClipRect(Geom::Rect{{2, 2}, {35, 25}});
+	drawCircles(reference, circles);
+
+	Canvas tiled;
+	tiled.setTiling(16, 4);
+	tiled.setClipRect(Geom::Rect{{2, 2}, {35, 25}});
+	auto grid = tiled.tileGrid();
+	check->*grid.columns == 3U;
+	check->*grid.rows == 2U;
+
+	std::vector<int> visited(6);
+	auto drawn = tiled.drawTiles(
+	    [&](std::size_t index, Gfx::ICanvas &tile)
+	    {
+		    ++visited[index];
+		    drawCircles(tile, circles);
+	    });
+	check->*drawn == "tiles are supported"_is_true;
+	check->*(visited == std::vector<int>(6, 1))
+	    == "each tile drawn once"_is_true;
+
+	auto maxDiff = 0;
+	for (auto i = 0U; i < reference.getPixels().size(); ++i)
+		maxDiff = std::max(maxDiff,
+		    std::abs(reference.getPixels()[i] - tiled.getPixels()[i]));
+	check->*(maxDiff <= 1) == "pixels match"_is_true;
+}
+
+    | "tiling is off by default" | []
+{
+	Canvas canvas;
+	check->*canvas.tileGrid().columns == 0U;
+	check->*canvas.drawTiles([](std::size_t, Gfx::ICanvas &) {})
+	    == "tiling refused"_is_false;
+}
+
+    | "tiled draws reuse the worker threads" | []
+{
+	Canvas canvas;
+	canvas.setTiling(4, 3);
+
+	std::mutex mutex;
+	std::set<std::thread::id> ids;
+	for (auto i = 0; i < 3; ++i)
+		check->*canvas.drawTiles(
+		    [&](std::size_t, Gfx::ICanvas &)
+		    {
+			    const std::lock_guard lock{mutex};
+			    ids.insert(std::this_thread::get_id());
+		    })
+		    == "tiles are supported"_is_true;
+
+	check->*(ids.size() <= 3U) == "at most 3 threads"_is_true;
+	check->*ids.contains(std::this_thread::get_id())
+	    == "caller takes part"_is_true;
+}
+
+    | "tiles need an axis aligned transform" | []
+{
+	Canvas canvas;
+	canvas.setTiling(16);
+	canvas.transform(Geom::AffineTransform{{}, 1.0, 0.5});
+	check->*canvas.tileGrid().columns == 0U;
+	check->*canvas.drawTiles([](std::size_t, Gfx::ICanvas &) {})
+	    == "tiling refused"_is_false;
+};
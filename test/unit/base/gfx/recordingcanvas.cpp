@@ -0,0 +1,204 @@
+#include "base/gfx/recordingcanvas.h"
+
+#include <string>
+#include <vector>
+
+#include "../../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+using test::operator""_is_false;
+
+using Command = Gfx::RecordingCanvas::Command;
+
+namespace
+{
+
+struct Canvas final : Gfx::RecordingCanvas
+{
+	std::vector<std::vector<Command>> flushed;
+
+	void flush() final
+	{
+		flushed.push_back(getCommands());
+		clearCommands();
+	}
+	void *getPainter() final { return nullptr; }
+};
+
+}
+
+const static auto tests =
+    "Gfx::RecordingCanvas"_suite
+
+    | "records commands and arguments" | []
+{
+	Canvas canvas;
+	canvas.frameBegin();
+	canvas.setBrushColor(Gfx::Color{0.1, 0.2, 0.3, 0.4});
+	canvas.setBrushColor(Gfx::Color{0.1, 0.2, 0.3, 0.4});
+	canvas.rectangle(Geom::Rect{{1, 2}, {3, 4}});
+	canvas.text(Geom::Rect{{5, 6}, {7, 8}}, "label");
+	canvas.text(Geom::Rect{{5, 6}, {7, 8}}, "label");
+	canvas.save();
+	canvas.restore();
+	canvas.setBrushColor(Gfx::Color{0.1, 0.2, 0.3, 0.4});
+
+	check->*(canvas.getCommands()
+	         == std::vector{Command::setBrushColor,
+	             Command::rectangle,
+	             Command::text,
+	             Command::text,
+	             Command::save,
+	             Command::restore,
+	             Command::setBrushColor})
+	    == "commands recorded"_is_true;
+
+	check->*(canvas.getArguments()
+	         == std::vector{0.1,
+	             0.2,
+	             0.3,
+	             0.4,
+	             1.0,
+	             2.0,
+	             3.0,
+	             4.0,
+	             5.0,
+	             6.0,
+	             7.0,
+	             8.0,
+	             0.0,
+	             5.0,
+	             6.0,
+	             7.0,
+	             8.0,
+	             0.0,
+	             0.1,
+	             0.2,
+	             0.3,
+	             0.4})
+	    == "arguments recorded"_is_true;
+
+	check->*canvas.getStrings().size() == 1u;
+	check->*canvas.getStrings().front() == std::string{"label"};
+}
+
+    | "gradient stops are inlined" | []
+{
+	Canvas canvas;
+	canvas.frameBegin();
+	canvas.setBrushGradient(Gfx::LinearGradient{{{0, 0}, {1, 1}},
+	    Gfx::ColorGradient{{{0.0, Gfx::Color{1, 0, 0, 1}},
+	        {1.0, Gfx::Color{0, 0, 1, 1}}}}});
+
+	check->*canvas.getCommands().size() == 1u;
+	check->*canvas.getArguments().size() == 5u + 2u * 5u;
+	check->*canvas.getArguments()[4] == 2.0;
+	check->*canvas.getArguments()[10] == 1.0;
+	check->*canvas.getArguments()[13] == 1.0;
+}
+
+    | "frame begin clears the buffer" | []
+{
+	Canvas canvas;
+	canvas.frameBegin();
+	canvas.setFont(Gfx::Font{});
+	canvas.line(Geom::Line{{0, 0}, {1, 1}});
+	canvas.frameBegin();
+
+	check->*canvas.getCommands().empty() == "commands cleared"_is_true;
+	check->*canvas.getArguments().empty()
+	    == "arguments cleared"_is_true;
+	check->*canvas.getStrings().empty() == "strings cleared"_is_true;
+}
+
+    | "layers replay with remapped strings" | []
+{
+	Canvas canvas;
+	canvas.frameBegin();
+	canvas.text(Geom::Rect{{0, 0}, {1, 1}}, "other");
+	canvas.beginLayer(1, 42);
+	canvas.setFont(Gfx::Font{});
+	canvas.setBrushColor(Gfx::Color{0.1, 0.2, 0.3, 0.4});
+	canvas.text(Geom::Rect{{5, 6}, {7, 8}}, "label");
+	canvas.endLayer();
+	auto commands = canvas.getCommands();
+	commands.erase(commands.begin());
+
+	canvas.frameBegin();
+	check->*canvas.replayLayer(1, 43) == "stale key rejected"_is_false;
+	check->*canvas.replayLayer(2, 42) == "unknown id rejected"_is_false;
+	check->*canvas.replayLayer(1, 42) == "layer replayed"_is_true;
+
+	check->*(canvas.getCommands() == commands)
+	    == "commands replayed"_is_true;
+	check->*canvas.getStrings().size() == 2u;
+	check->*canvas.getStrings()[static_cast<std::size_t>(
+	              canvas.getArguments()[0])]
+	    == Gfx::Font{}.toCSS();
+	check->*canvas.getStrings()[static_cast<std::size_t>(
+	              canvas.getArguments().back())]
+	    == std::string{"label"};
+
+	canvas.setBrushColor(Gfx::Color{0.1, 0.2, 0.3, 0.4});
+	check->*canvas.getCommands().back() == Command::setBrushColor;
+}
+
+    | "batched rectangles inline their colors" | []
+{
+	Canvas canvas;
+	canvas.frameBegin();
+	const std::vector rects{Geom::Rect{{1, 2}, {3, 4}},
+	    Geom::Rect{{5, 6}, {7, 8}}};
+	const std::vector brushColors{Gfx::Color{1, 0, 0, 1},
+	    Gfx::Color{0, 1, 0, 1}};
+	const std::vector lineColors{Gfx::Color{0, 0, 1, 1},
+	    Gfx::Color{0, 0, 0, 1}};
+
+	check->*canvas.rectangles(rects, brushColors, lineColors)
+	    == "batch supported"_is_true;
+	check->*canvas.getCommands().size() == 1u;
+	check->*canvas.getArguments().size() == 1u + 2u * 12u;
+	check->*canvas.getArguments()[0] == 2.0;
+	check->*canvas.getArguments()[13] == 5.0;
+
+	canvas.setBrushColor(Gfx::Color{0, 1, 0, 1});
+	canvas.setLineColor(Gfx::Color{0, 0, 0, 1});
+	check->*canvas.getCommands().size() == 1u;
+}
+
+    | "flushed commands are dropped, states kept" | []
+{
+	Canvas canvas;
+	canvas.frameBegin();
+	canvas.setBrushColor(Gfx::Color{0.1, 0.2, 0.3, 0.4});
+	canvas.text(Geom::Rect{{5, 6}, {7, 8}}, "label");
+	canvas.flush();
+
+	canvas.setBrushColor(Gfx::Color{0.1, 0.2, 0.3, 0.4});
+	canvas.text(Geom::Rect{{5, 6}, {7, 8}}, "other");
+
+	check->*canvas.flushed.size() == 1u;
+	check->*(canvas.flushed.front()
+	         == std::vector{Command::setBrushColor, Command::text})
+	    == "first part flushed"_is_true;
+	check->*(canvas.getCommands() == std::vector{Command::text})
+	    == "brush color not repeated"_is_true;
+	check->*canvas.getStrings().size() == 1u;
+	check->*canvas.getArguments().back() == 0.0;
+}
+
+    | "flush drops the open layer" | []
+{
+	Canvas canvas;
+	canvas.frameBegin();
+	canvas.beginLayer(1, 42);
+	canvas.rectangle(Geom::Rect{{1, 2}, {3, 4}});
+	canvas.flush();
+	canvas.rectangle(Geom::Rect{{1, 2}, {3, 4}});
+	canvas.endLayer();
+
+	canvas.frameBegin();
+	check->*canvas.replayLayer(1, 42) == "not cached"_is_false;
+};
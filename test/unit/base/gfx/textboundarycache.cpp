@@ -0,0 +1,88 @@
+#include "base/gfx/textboundarycache.h"
+
+#include <cstddef>
+#include <string>
+#include <tuple>
+
+#include "../../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+
+using Gfx::Font;
+using Gfx::TextBoundaryCache;
+
+namespace
+{
+
+std::size_t measured{};
+
+Geom::Size measure(const Font &font, const std::string &text)
+{
+	++measured;
+	return {static_cast<double>(text.size()) * font.size / 2.0,
+	    font.size};
+}
+
+}
+
+const static auto tests =
+    "Gfx::TextBoundaryCache"_suite
+
+    | "repeated measurements hit the cache" | []
+{
+	measured = 0;
+	TextBoundaryCache cache{&measure};
+	const Font font{10.0};
+
+	check->*cache.get(font, "abcd").x == 20.0;
+	check->*cache.get(font, "abcd").x == 20.0;
+	check->*cache.get(Font{20.0}, "abcd").x == 40.0;
+
+	auto stats = cache.getStats();
+	check->*measured == 2u;
+	check->*stats.hits == 1u;
+	check->*stats.misses == 2u;
+	check->*stats.size == 2u;
+
+	cache.clear();
+	check->*cache.get(font, "abcd").x == 20.0;
+	check->*measured == 3u;
+}
+
+    | "least recently used entry is evicted" | []
+{
+	measured = 0;
+	TextBoundaryCache cache{&measure, 2};
+	const Font font{10.0};
+
+	std::ignore = cache.get(font, "a");
+	std::ignore = cache.get(font, "b");
+	std::ignore = cache.get(font, "a");
+	std::ignore = cache.get(font, "c");
+	check->*cache.getStats().size == 2u;
+	check->*measured == 3u;
+
+	std::ignore = cache.get(font, "a");
+	check->*measured == 3u;
+	std::ignore = cache.get(font, "b");
+	check->*measured == 4u;
+}
+
+    | "glyph advance mode sums known glyphs" | []
+{
+	measured = 0;
+	TextBoundaryCache cache{&measure};
+	cache.setGlyphAdvanceMode(true);
+	const Font font{10.0};
+
+	check->*cache.get(font, "ab").x == 10.0;
+	check->*measured == 3u;
+
+	check->*cache.get(font, "ba").x == 10.0;
+	check->*measured == 3u;
+	check->*cache.getStats().glyphHits == 1u;
+
+	check->*cache.get(font, "a\nb").x == 15.0;
+	check->*measured == 4u;
+};
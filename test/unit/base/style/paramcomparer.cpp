@@ -0,0 +1,33 @@
+#include "base/style/paramcomparer.h"
+
+#include "../../util/test.h"
+#include "../testclasses.h"
+
+using test::check;
+using test::collection;
+
+const static auto tests =
+    collection::add_suite("Style::ParamComparer")
+
+        .add_case("equal_parameters_are_equal",
+            []
+            {
+	            const Fobar lhs{{1, 2}, {5, 6}};
+	            const Fobar rhs{{1, 2}, {5, 6}};
+
+	            check() << Style::ParamComparer::equals(lhs, rhs)
+	                == true;
+            })
+
+        .add_case("set_and_unset_parameters_differ",
+            []
+            {
+	            const Fobar lhs{{1, 2}, {5, 6}};
+	            Fobar rhs{{1, 2}, {5, 6}};
+	            rhs.baz.fobar.reset();
+
+	            check() << Style::ParamComparer::equals(lhs, rhs)
+	                == false;
+            })
+
+    ;
@@ -0,0 +1,81 @@
+#include "base/util/profiler.h"
+
+#include <string>
+#include <thread>
+
+#include "../../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+using test::operator""_is_false;
+
+using Util::Profiler;
+
+const static auto tests =
+    "Util::Profiler"_suite
+
+    | "disabled by default" | []
+{
+	check->*Profiler::isEnabled() == "disabled"_is_false;
+
+	Profiler::count("test", 1.0);
+	{
+		const Profiler::Scope scope{"test stage"};
+	}
+	check->*Profiler::toJSON()
+	    == std::string{
+	        R"({"enabled":false,"stages":{},"counters":{}})"};
+}
+
+    | "percentiles of recorded values" | []
+{
+	Profiler::setEnabled(true);
+	for (auto i = 100; i > 0; --i)
+		Profiler::count("test", static_cast<double>(i));
+	{
+		const Profiler::Scope scope{"test stage"};
+	}
+	auto json = Profiler::toJSON();
+	Profiler::setEnabled(false);
+
+	const auto *counter = R"("test":{"count":100,"p50":50.000000,)"
+	                      R"("p95":95.000000,"max":100.000000})";
+	const auto *stage = R"("test stage":{"count":1,)";
+	check->*(json.find(counter) != std::string::npos)
+	    == "counter stats"_is_true;
+	check->*(json.find(stage) != std::string::npos)
+	    == "stage stats"_is_true;
+}
+
+    | "ring buffer keeps the latest values" | []
+{
+	Profiler::setEnabled(true);
+	for (std::size_t i{}; i < Profiler::capacity * 2; ++i)
+		Profiler::count("test", i < Profiler::capacity ? 1e6 : 1.0);
+	auto json = Profiler::toJSON();
+	Profiler::setEnabled(false);
+
+	const auto *counter = R"("test":{"count":1024,"p50":1.000000,)"
+	                      R"("p95":1.000000,"max":1.000000})";
+	check->*(json.find(counter) != std::string::npos)
+	    == "latest values only"_is_true;
+}
+
+    | "values of other threads are merged" | []
+{
+	Profiler::setEnabled(true);
+	Profiler::count("test", 1.0);
+	std::thread{[]
+	    {
+		    Profiler::count("test", 2.0);
+		    Profiler::count("test", 3.0);
+	    }}.join();
+	auto json = Profiler::toJSON();
+	Profiler::setEnabled(false);
+
+	const auto *counter = R"("test":{"count":3,"p50":2.000000,)"
+	                      R"("p95":3.000000,"max":3.000000})";
+	check->*(json.find(counter) != std::string::npos)
+	    == "exited thread kept"_is_true;
+};
@@ -0,0 +1,129 @@
+#include "chart/rendering/colorbuilder.h"
+
+#include <cmath>
+#include <vector>
+
+#include "base/anim/interpolated.h"
+#include "base/gfx/color.h"
+#include "base/gfx/colorgradient.h"
+#include "base/gfx/colorpalette.h"
+#include "chart/generator/colorbase.h"
+
+#include "../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+
+using Vizzu::Draw::ColorBuilder;
+using Vizzu::Gen::ColorBase;
+
+namespace
+{
+
+bool near(const Gfx::Color &color, const Gfx::Color &expected)
+{
+	return std::abs(color.red - expected.red) < 1e-9
+	    && std::abs(color.green - expected.green) < 1e-9
+	    && std::abs(color.blue - expected.blue) < 1e-9
+	    && std::abs(color.alpha - expected.alpha) < 1e-9;
+}
+
+}
+
+const static auto tests =
+    "Draw::ColorBuilder"_suite
+
+    | "palette colors match the palette" | []
+{
+	const ::Anim::Interpolated<Gfx::ColorPalette> palette{
+	    Gfx::ColorPalette{Gfx::Color{1, 0, 0, 1},
+	        Gfx::Color{0, 1, 0, 1},
+	        Gfx::Color{0, 0, 1, 1}}};
+	const auto gradient = Gfx::ColorGradient::HeatMap5Color();
+	const ColorBuilder builder({-0.4, 0.4}, palette, gradient);
+
+	check->*(builder.render(ColorBase(4U, 0.5))
+	         == Gfx::Color{0, 1, 0, 1})
+	    == "index wraps around"_is_true;
+	check->*near(builder.render(ColorBase(2U, 1.0)),
+	    Gfx::Color{0.4, 0.4, 1, 1})
+	    == "lighter color"_is_true;
+	check->*near(builder.render(ColorBase(0U, 0.0)),
+	    Gfx::Color{0.6, 0, 0, 1})
+	    == "darker color"_is_true;
+}
+
+    | "gradient lookup matches the gradient" | []
+{
+	const ::Anim::Interpolated<Gfx::ColorPalette> palette{
+	    Gfx::ColorPalette{}};
+	const auto gradient = Gfx::ColorGradient::HeatMap5Color();
+	const ColorBuilder builder({0.0, 0.0}, palette, gradient);
+
+	for (auto pos : {0.0, 0.1, 0.25, 0.3337, 0.5, 0.9999, 1.0})
+		check->*near(builder.render(ColorBase(pos, 0.5)),
+		    gradient(pos))
+		    == "matches"_is_true;
+
+	check->*near(builder.render(ColorBase(1.5, 0.5)), gradient(1.5))
+	    == "outside of the table"_is_true;
+}
+
+    | "tables are kept while their inputs are unchanged" | []
+{
+	const ::Anim::Interpolated<Gfx::ColorPalette> palette{
+	    Gfx::ColorPalette{Gfx::Color{1, 0, 0, 1},
+	        Gfx::Color{0, 1, 0, 1}}};
+	const auto gradient = Gfx::ColorGradient::HeatMap5Color();
+	const ColorBuilder builder({-0.4, 0.4}, palette, gradient);
+
+	ColorBuilder::Tables tables;
+	builder.prepare(tables, 2000, true);
+	check->*tables.palette.size() == 2U;
+	check->*tables.gradient.size()
+	    == ColorBuilder::gradientResolution + 1;
+
+	const auto *paletteData = tables.palette.data();
+	const auto *gradientData = tables.gradient.data();
+	builder.prepare(tables, 2000, true);
+	check->*(tables.palette.data() == paletteData
+	         && tables.gradient.data() == gradientData)
+	    == "reused"_is_true;
+
+	const ::Anim::Interpolated<Gfx::ColorPalette> otherPalette{
+	    Gfx::ColorPalette{Gfx::Color{0, 0, 1, 1}}};
+	const ColorBuilder recolored({-0.4, 0.4},
+	    otherPalette,
+	    gradient);
+	recolored.prepare(tables, 2000, true);
+	check->*(tables.palette == std::vector{Gfx::Color{0, 0, 1, 1}})
+	    == "palette changed"_is_true;
+
+	const ColorBuilder relit({-0.2, 0.2}, otherPalette, gradient);
+	relit.prepare(tables, 1, true);
+	check->*(tables.palette.empty() && tables.gradient.empty())
+	    == "lightness range changed"_is_true;
+}
+
+    | "tables are not built for few markers" | []
+{
+	const ::Anim::Interpolated<Gfx::ColorPalette> palette{
+	    Gfx::ColorPalette{Gfx::Color{1, 0, 0, 1},
+	        Gfx::Color{0, 1, 0, 1},
+	        Gfx::Color{0, 0, 1, 1}}};
+	const auto gradient = Gfx::ColorGradient::HeatMap5Color();
+	const ColorBuilder builder({0.0, 0.0}, palette, gradient);
+
+	ColorBuilder::Tables tables;
+	builder.prepare(tables, 3, true);
+	check->*(tables.palette.empty() && tables.gradient.empty())
+	    == "not built"_is_true;
+
+	builder.prepare(tables, 100, true);
+	check->*tables.palette.size() == 3U;
+	check->*tables.gradient.empty() == "gradient not built"_is_true;
+
+	builder.prepare(tables, 2000, false);
+	check->*tables.gradient.empty() == "no gradient used"_is_true;
+};
@@ -1,7 +1,17 @@
 
+#include <cmath>
+#include <set>
+#include <string>
+#include <thread>
+#include <tuple>
+#include <vector>
+
 #include <chart/rendering/painter/painter.h>
 
 #include "../util/test.h"
+#include "base/gfx/recordingcanvas.h"
+#include "chart/generator/plot.h"
+#include "chart/main/frameexporter.h"
 #include "chart/ui/chart.h"
 
 using test::operator""_suite;
@@ -11,7 +21,7 @@ using test::skip;
 using test::operator""_is_true;
 using test::operator""_is_false;
 
-Geom::Size Gfx::ICanvas::textBoundary(const Font &font,
+Geom::Size Gfx::ICanvas::measureText(const Font &font,
     const std::string &text)
 {
 	return {static_cast<double>(text.size()) * font.size / 2.0,
@@ -20,6 +30,8 @@ Geom::Size Gfx::ICanvas::textBoundary(const Font &font,
 
 struct MyCanvas final : Gfx::ICanvas, Vizzu::Draw::Painter
 {
+	std::size_t primitives{};
+
 	MyCanvas() noexcept = default;
 	~MyCanvas() final = default;
 	void setClipRect(const Geom::Rect &) final {}
@@ -43,11 +55,14 @@ struct MyCanvas final : Gfx::ICanvas, Vizzu::Draw::Painter
 	    const Geom::Point &,
 	    const Geom::Point &) final
 	{}
-	void endPolygon() final {}
-	void rectangle(const Geom::Rect &) final {}
-	void circle(const Geom::Circle &) final {}
-	void line(const Geom::Line &) final {}
-	void text(const Geom::Rect &, const std::string &) final {}
+	void endPolygon() final { ++primitives; }
+	void rectangle(const Geom::Rect &) final { ++primitives; }
+	void circle(const Geom::Circle &) final { ++primitives; }
+	void line(const Geom::Line &) final { ++primitives; }
+	void text(const Geom::Rect &, const std::string &) final
+	{
+		++primitives;
+	}
 	void setBrushGradient(const Gfx::LinearGradient &) final {}
 	void frameBegin() final {}
 	void frameEnd() final {}
@@ -56,6 +71,15 @@ struct MyCanvas final : Gfx::ICanvas, Vizzu::Draw::Painter
 	ICanvas &getCanvas() final { return *this; }
 };
 
+struct MyRecordingCanvas final :
+    Gfx::RecordingCanvas,
+    Vizzu::Draw::Painter
+{
+	void *getPainter() final { return static_cast<Painter *>(this); }
+	// cppcheck-suppress duplInheritedMember
+	ICanvas &getCanvas() final { return *this; }
+};
+
 auto testcase_0 = [](Vizzu::Data::DataTable &table)
 {
 	table.add_dimension(std::initializer_list<const char *>{},
@@ -391,6 +415,29 @@ std::multimap<std::string, event_as, std::less<>> get_events(
 	return events;
 }
 
+void showSteady(Vizzu::Chart &chart)
+{
+	chart.getAnimOptions().control.position = 1.0;
+	chart.setKeyframe();
+	chart.animate({});
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	chart.setBoundRect(chart.getLayout().boundary);
+}
+
+std::size_t hitMarkers(const Vizzu::Chart &chart,
+    const Geom::Rect &area)
+{
+	std::set<const Util::EventTarget *> markers;
+	for (auto px = area.left(); px < area.right(); px += 2.0)
+		for (auto py = area.bottom(); py < area.top(); py += 2.0)
+			if (const auto *target =
+			        chart.getRenderedChart().find({px, py});
+			    target
+			    && target->toJSON().contains("\"plot-marker\""))
+				markers.insert(target);
+	return markers.size();
+}
+
 using enum Vizzu::Gen::ChannelId;
 using enum Vizzu::Gen::ShapeType;
 using enum Vizzu::Gen::CoordSystem;
@@ -659,4 +706,327 @@ const static auto tests =
 	check->*events.count("plot-axis-label-draw") == 1u;
 	check->*events.count("plot-axis-title-draw") == 2u;
 	check->*events.count("plot-marker-draw") == 0u;
-};
\ No newline at end of file
+}
+
+    | "async keyframe" |
+    [](Vizzu::Chart &chart = chart_setup{{{x, "Dim5"}, {y, "Meas1"}}})
+{
+	chart.getAnimOptions().control.position = 1.0;
+
+	static bool ends{};
+	ends = false;
+	chart.setKeyframeAsync();
+	chart.animate({[](const Vizzu::Gen::PlotPtr &, const bool &b)
+	    {
+		    ends = b;
+	    }});
+
+	MyCanvas canvas;
+	while (chart.isKeyframePreparing()) {
+		chart.draw(canvas.getCanvas());
+		std::this_thread::yield();
+	}
+
+	using clock_t = std::chrono::steady_clock;
+	chart.getAnimControl()->update(clock_t::now());
+	chart.draw(canvas.getCanvas());
+	chart.getAnimControl()->update(clock_t::now());
+
+	check->*ends == "finished"_is_true;
+	assert->*chart.getPlot() != nullptr;
+	check->*chart.getPlot()->getMarkers().size() == 5u;
+}
+
+    | "async keyframe replaced by a newer request" |
+    [](Vizzu::Chart &chart = chart_setup{{{x, "Dim5"}, {y, "Meas1"}}})
+{
+	chart.getAnimOptions().control.position = 1.0;
+
+	static bool ends{};
+	ends = false;
+	chart.setKeyframeAsync();
+	chart.getOptions().getChannels().at(x).addSeries(
+	    {"Dim2", std::ref(chart.getTable())});
+	chart.setKeyframeAsync();
+	chart.getTable().add_measure(
+	    {{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}},
+	    "Meas3");
+	chart.animate({[](const Vizzu::Gen::PlotPtr &, const bool &b)
+	    {
+		    ends = b;
+	    }});
+
+	MyCanvas canvas;
+	while (chart.isKeyframePreparing()) {
+		chart.draw(canvas.getCanvas());
+		std::this_thread::yield();
+	}
+
+	using clock_t = std::chrono::steady_clock;
+	chart.getAnimControl()->update(clock_t::now());
+	chart.draw(canvas.getCanvas());
+	chart.getAnimControl()->update(clock_t::now());
+
+	check->*ends == "finished"_is_true;
+	assert->*chart.getPlot() != nullptr;
+	check->*chart.getPlot()
+	        ->getOptions()
+	        ->getChannels()
+	        .at(x)
+	        .dimensions()
+	        .size()
+	    == 2u;
+}
+
+    | "hit geometry recorded without listeners" |
+    [](Vizzu::Chart &chart = chart_setup{{{x, "Dim5"}, {y, "Meas1"}}})
+{
+	showSteady(chart);
+	chart.draw(MyCanvas{}.getCanvas());
+
+	check->*hitMarkers(chart, chart.getLayout().plot) == 5u;
+}
+
+    | "transparent markers are hit tested but not drawn" | []
+{
+	auto draw = [](bool transparent, bool batched)
+	{
+		chart_setup setup{{{x, "Dim5"}, {y, "Meas1"}}};
+		Vizzu::Chart &chart = setup;
+		if (transparent) {
+			chart.getStyles().plot.marker.fillOpacity = 0.0;
+			chart.getStyles().plot.marker.borderWidth = 0.0;
+		}
+		showSteady(chart);
+
+		std::size_t primitives{};
+		if (batched)
+			chart.draw(MyRecordingCanvas{}.getCanvas());
+		else {
+			MyCanvas canvas;
+			chart.draw(canvas.getCanvas());
+			primitives = canvas.primitives;
+		}
+		return std::pair{hitMarkers(chart, chart.getLayout().plot),
+		    primitives};
+	};
+
+	auto [opaqueHits, opaquePrimitives] = draw(false, false);
+	auto [hits, primitives] = draw(true, false);
+	check->*opaqueHits == 5u;
+	check->*hits == 5u;
+	check->*(opaquePrimitives - primitives) == 5u;
+
+	check->*draw(false, true).first == 5u;
+	check->*draw(true, true).first == 5u;
+}
+
+    | "off-screen markers are hit tested" | []
+{
+	for (auto batched : {false, true}) {
+		chart_setup setup{{{x, "Dim5"}, {y, "Meas1"}}};
+		Vizzu::Chart &chart = setup;
+		showSteady(chart);
+
+		// zooming in, the markers slide out before they are hidden
+		chart.getAnimControl()->update(
+		    std::chrono::steady_clock::now());
+		auto &range = chart.getOptions().getChannels().at(x).range;
+		range.min = Vizzu::Base::AutoParam{
+		    Vizzu::Gen::ChannelExtrema::fromString("-0.5")};
+		range.max = Vizzu::Base::AutoParam{
+		    Vizzu::Gen::ChannelExtrema::fromString("0.5")};
+		chart.getAnimOptions().set("x.delay", "0s");
+		chart.getAnimOptions().set("hide.delay", "3s");
+		chart.getAnimOptions().control.position = 0.5;
+		chart.setKeyframe();
+		chart.animate({});
+		chart.getAnimControl()->update(
+		    std::chrono::steady_clock::now());
+		chart.setBoundRect(chart.getLayout().boundary);
+
+		if (batched)
+			chart.draw(MyRecordingCanvas{}.getCanvas());
+		else
+			chart.draw(MyCanvas{}.getCanvas());
+
+		const auto &plot = chart.getLayout().plot;
+		check->*hitMarkers(chart, plot) == 1u;
+		check->*hitMarkers(chart,
+		    {{plot.left(), plot.bottom()},
+		        {6 * plot.width(), plot.height()}})
+		    == 5u;
+	}
+}
+
+    | "layers replayed until their inputs change" | []
+{
+	struct LayerCanvas final :
+	    Gfx::RecordingCanvas,
+	    Vizzu::Draw::Painter
+	{
+		std::size_t drawnLayers{};
+
+		void beginLayer(std::size_t id, std::size_t key) final
+		{
+			++drawnLayers;
+			RecordingCanvas::beginLayer(id, key);
+		}
+		void *getPainter() final
+		{
+			return static_cast<Painter *>(this);
+		}
+		// cppcheck-suppress duplInheritedMember
+		ICanvas &getCanvas() final { return *this; }
+	};
+
+	chart_setup setup{{{x, "Dim5"}, {y, "Meas1"}}};
+	Vizzu::Chart &chart = setup;
+	chart.getAnimOptions().control.position = 1.0;
+	chart.setKeyframe();
+	chart.animate({});
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	chart.setBoundRect(chart.getLayout().boundary);
+
+	LayerCanvas canvas;
+	auto drawFrame = [&canvas, &chart]
+	{
+		canvas.drawnLayers = 0;
+		canvas.frameBegin();
+		chart.draw(canvas);
+		canvas.frameEnd();
+		return canvas.drawnLayers;
+	};
+
+	check->*drawFrame() == 9u;
+	check->*drawFrame() == 0u;
+
+	chart.setBoundRect(Geom::Rect(Geom::Point{}, {{800, 600}}));
+	check->*drawFrame() == 9u;
+	check->*drawFrame() == 0u;
+
+	// an animation step redraws only the layers of the plot
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	chart.getOptions().getChannels().at(y).removeSeries(
+	    {"Meas1", std::ref(chart.getTable())});
+	chart.getOptions().getChannels().at(y).addSeries(
+	    {"Meas2", std::ref(chart.getTable())});
+	chart.getAnimOptions().control.position = 0.5;
+	chart.setKeyframe();
+	chart.animate({});
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	chart.setBoundRect(chart.getLayout().boundary);
+	check->*drawFrame() == 4u;
+	check->*drawFrame() == 0u;
+
+	chart.getAnimControl()->seekProgress(0.75);
+	chart.getAnimControl()->update();
+	chart.setBoundRect(chart.getLayout().boundary);
+	check->*drawFrame() == 4u;
+	check->*drawFrame() == 0u;
+	check->*hitMarkers(chart, chart.getLayout().plot) == 5u;
+}
+
+    | "layout recomputed only when its inputs change" | []
+{
+	chart_setup setup{{{x, "Dim5"}, {y, "Meas1"}}};
+	Vizzu::Chart &chart = setup;
+	chart.getAnimOptions().control.position = 1.0;
+	chart.setKeyframe();
+	chart.animate({});
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+
+	auto &textCache = Gfx::ICanvas::textBoundaryCache();
+	auto lookups = [&textCache]
+	{
+		auto stats = textCache.getStats();
+		return stats.hits + stats.misses;
+	};
+	auto layoutLookups = [&](const Geom::Rect &rect)
+	{
+		auto before = lookups();
+		chart.setBoundRect(rect);
+		return lookups() - before;
+	};
+
+	const Geom::Rect small{Geom::Point{}, {{640, 480}}};
+	const Geom::Rect large{Geom::Point{}, {{800, 600}}};
+	chart.setBoundRect(small);
+	check->*layoutLookups(small) == 0u;
+
+	check->*(layoutLookups(large) > 0) == "resized"_is_true;
+	check->*layoutLookups(large) == 0u;
+
+	textCache.clear();
+	check->*(layoutLookups(large) > 0)
+	    == "text measurement changed"_is_true;
+	check->*layoutLookups(large) == 0u;
+
+	auto plotHeight = chart.getLayout().plot.height();
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	chart.getOptions().title = std::string{"Title"};
+	chart.getAnimOptions().control.position = 1.0;
+	chart.setKeyframe();
+	chart.animate({});
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	check->*(layoutLookups(large) > 0) == "new plot"_is_true;
+	check->*(chart.getLayout().plot.height() < plotHeight)
+	    == "title area added"_is_true;
+}
+
+    | "offline frame export" | []
+{
+	using Command = Gfx::RecordingCanvas::Command;
+	using Frame = std::tuple<std::vector<Command>,
+	    std::vector<double>,
+	    std::vector<std::string>>;
+
+	auto exportFrames = [](std::size_t threads, bool listen)
+	{
+		chart_setup setup{{{x, "Dim5"}, {y, "Meas1"}}};
+		Vizzu::Chart &chart = setup;
+		std::size_t drawEvents{};
+		auto &&event =
+		    chart.getEventDispatcher().getEvent("plot-marker-draw");
+		if (listen)
+			event->attach(
+			    [&drawEvents](Util::EventDispatcher::Params &,
+			        const std::string &)
+			    {
+				    ++drawEvents;
+			    });
+		chart.setKeyframe();
+		chart.animate({});
+		auto duration = chart.getAnimation()->getDuration().sec();
+
+		std::vector<Frame> frames;
+		Vizzu::FrameExporter{chart, {640, 480}, {10.0, threads}}.run(
+		    []
+		    {
+			    return std::make_unique<MyRecordingCanvas>();
+		    },
+		    [&frames](std::size_t frame, Gfx::ICanvas &canvas)
+		    {
+			    assert->*frame == frames.size();
+			    const auto &recorded =
+			        dynamic_cast<MyRecordingCanvas &>(canvas);
+			    frames.emplace_back(recorded.getCommands(),
+			        recorded.getArguments(),
+			        recorded.getStrings());
+		    });
+
+		check->*frames.size()
+		    == static_cast<std::size_t>(std::ceil(duration * 10.0))
+		           + 1;
+		if (listen)
+			check->*(drawEvents > 0)
+			    == "draw events dispatched"_is_true;
+		return frames;
+	};
+
+	auto sequential = exportFrames(1, false);
+	check->*(sequential == exportFrames(4, false))
+	    == "parallel frames identical"_is_true;
+	check->*(exportFrames(1, true) == exportFrames(4, true))
+	    == "frames identical with listeners"_is_true;
+};
@@ -0,0 +1,76 @@
+#include "chart/rendering/labellayout.h"
+
+#include <numbers>
+
+#include "base/geom/affinetransform.h"
+#include "base/geom/point.h"
+#include "base/geom/rect.h"
+#include "base/geom/transformedrect.h"
+
+#include "../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+using test::operator""_is_false;
+
+using Vizzu::Draw::LabelLayout;
+
+namespace
+{
+
+Geom::TransformedRect box(double x, double y, double w, double h)
+{
+	return Geom::TransformedRect::fromRect(
+	    {Geom::Point{x, y}, Geom::Size{w, h}});
+}
+
+}
+
+const static auto tests =
+    "LabelLayout"_suite
+
+    | "overlapping label is rejected" | []
+{
+	LabelLayout layout;
+	check->*layout.place(box(0, 0, 40, 10)) == "first"_is_true;
+	check->*layout.place(box(30, 5, 40, 10)) == "overlap"_is_false;
+	check->*layout.place(box(35, 20, 40, 10)) == "below"_is_true;
+}
+
+    | "touching and distant labels are placed" | []
+{
+	LabelLayout layout(16.0);
+	check->*layout.place(box(0, 0, 40, 10)) == "first"_is_true;
+	check->*layout.place(box(40, 0, 40, 10)) == "touching"_is_true;
+	check->*layout.place(box(500, -300, 40, 10))
+	    == "distant"_is_true;
+	check->*layout.place(box(510, -295, 5, 2))
+	    == "inside distant"_is_false;
+}
+
+    | "rotated label uses its exact outline" | []
+{
+	LabelLayout layout;
+	check->*layout.place(
+	    {Geom::AffineTransform(Geom::Point{0, 0},
+	         1.0,
+	         -std::numbers::pi / 4),
+	        Geom::Size{100, 10}})
+	    == "rotated"_is_true;
+	check->*layout.place(box(0, 40, 20, 20))
+	    == "inside bounding box only"_is_true;
+	check->*layout.place(box(30, 30, 10, 10))
+	    == "on the diagonal"_is_false;
+}
+
+    | "faint labels are not laid out" | []
+{
+	LabelLayout layout;
+	check->*(LabelLayout::forAlpha(&layout, 0.05) == nullptr)
+	    == "fading"_is_true;
+	check->*(LabelLayout::forAlpha(&layout, 0.5) == &layout)
+	    == "visible"_is_true;
+	check->*(LabelLayout::forAlpha(nullptr, 1.0) == nullptr)
+	    == "no layout"_is_true;
+};
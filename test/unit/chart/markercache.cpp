@@ -0,0 +1,280 @@
+#include "chart/rendering/markercache.h"
+
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <memory>
+#include <string>
+#include <variant>
+
+#include "base/geom/rect.h"
+#include "base/util/eventdispatcher.h"
+#include "chart/generator/plot.h"
+#include "chart/main/events.h"
+#include "chart/main/style.h"
+#include "chart/rendering/drawingcontext.h"
+#include "chart/rendering/markers/abstractmarker.h"
+#include "chart/rendering/painter/coordinatesystem.h"
+#include "chart/rendering/renderedchart.h"
+#include "chart/ui/chart.h"
+
+#include "../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+
+using Vizzu::Draw::AbstractMarker;
+using Vizzu::Draw::CoordinateSystem;
+using Vizzu::Draw::MarkerCache;
+using enum Vizzu::Gen::ChannelId;
+
+namespace
+{
+
+void setup(Vizzu::Chart &chart, Vizzu::Gen::ShapeType geometry)
+{
+	auto &table = chart.getTable();
+	table.add_dimension({{"A", "B", "C", "D", "E"}},
+	    {{0, 0, 1, 1, 2, 2, 3, 3, 4, 4}},
+	    "Dim5");
+	table.add_measure({{1, 2, 3, 4, 5, 6, 7, 8, 9, 10}}, "Meas1");
+	table.add_measure({{5, 4, 3, 2, 1, 8, 7, 6, 5, 4}}, "Meas2");
+
+	auto &options = chart.getOptions();
+	options.geometry = geometry;
+	auto &channels = options.getChannels();
+	channels.at(x).addSeries({"Dim5", std::ref(table)});
+	channels.at(y).addSeries({"Meas1", std::ref(table)});
+
+	// a fixed range keeps the markers in place whose value is kept
+	channels.at(y).range.min = Vizzu::Base::AutoParam{
+	    Vizzu::Gen::ChannelExtrema::fromString("0")};
+	channels.at(y).range.max = Vizzu::Base::AutoParam{
+	    Vizzu::Gen::ChannelExtrema::fromString("20")};
+
+	chart.setBoundRect(Geom::Rect(Geom::Point{}, {{640, 480}}));
+}
+
+void showSteady(Vizzu::Chart &chart)
+{
+	chart.getAnimOptions().control.position = 1.0;
+	chart.setKeyframe();
+	chart.animate({});
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	chart.setBoundRect(chart.getLayout().boundary);
+}
+
+// starts an animation which changes the value of the marker "B"
+void startFiltering(Vizzu::Chart &chart)
+{
+	struct NoDelete
+	{
+		void operator()(bool (*)(const Vizzu::Data::RowWrapper *)) {}
+	};
+
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	chart.getOptions().dataFilter = Vizzu::Data::Filter{
+	    std::unique_ptr<bool(const Vizzu::Data::RowWrapper *),
+	        NoDelete>{+[](const Vizzu::Data::RowWrapper *row)
+	        {
+		        return std::get<double>(row->get_value("Meas1"))
+		            != 3.0;
+	        }}};
+	chart.getAnimOptions().control.position = 0.25;
+	chart.setKeyframe();
+	chart.animate({});
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+}
+
+void seek(Vizzu::Chart &chart, double progress)
+{
+	chart.getAnimControl()->seekProgress(progress);
+	chart.getAnimControl()->update();
+}
+
+CoordinateSystem coordSys(const Vizzu::Chart &chart)
+{
+	const auto &plot = chart.getPlot();
+	return CoordinateSystem{chart.getLayout().plotArea,
+	    plot->getOptions()->angle,
+	    plot->getOptions()->coordSystem,
+	    plot->keepAspectRatio};
+}
+
+bool equal(const AbstractMarker &lhs, const AbstractMarker &rhs)
+{
+	return &lhs.marker == &rhs.marker
+	    && lhs.shapeType == rhs.shapeType
+	    && lhs.enabled == rhs.enabled
+	    && lhs.labelEnabled == rhs.labelEnabled
+	    && lhs.connected == rhs.connected
+	    && lhs.morphToCircle == rhs.morphToCircle
+	    && lhs.linear == rhs.linear && lhs.border == rhs.border
+	    && lhs.points == rhs.points && lhs.lineWidth == rhs.lineWidth
+	    && lhs.center == rhs.center && lhs.dataRect == rhs.dataRect
+	    && lhs.radius == rhs.radius
+	    && lhs.dataPosition.top == rhs.dataPosition.top
+	    && lhs.dataPosition.center == rhs.dataPosition.center;
+}
+
+// updates the cache and checks it against freshly built markers
+bool updateMatches(MarkerCache &cache,
+    const Vizzu::Chart &chart,
+    const Vizzu::Gen::Options &options,
+    const Vizzu::Styles::Chart &style,
+    const CoordinateSystem &coordSys)
+{
+	Util::EventDispatcher dispatcher;
+	const Vizzu::Events events{dispatcher};
+	Vizzu::Draw::RenderedChart rendered{coordSys, chart.getPlot()};
+	const Vizzu::Draw::DrawingContext ctx{chart.getPlot(),
+	    &options,
+	    rendered,
+	    coordSys,
+	    style,
+	    events};
+
+	auto cached = cache.update(ctx);
+	std::size_t i{};
+	for (const auto &marker : ctx.plot->getMarkers()) {
+		if (marker.enabled == false) continue;
+		if (i >= cached.size()
+		    || !equal(cached[i++],
+		        AbstractMarker::createInterpolated(ctx,
+		            marker,
+		            ::Anim::first)))
+			return false;
+	}
+	return i == cached.size();
+}
+
+bool updateMatches(MarkerCache &cache, const Vizzu::Chart &chart)
+{
+	const auto &plot = chart.getPlot();
+	return updateMatches(cache,
+	    chart,
+	    *plot->getOptions(),
+	    plot->getStyle(),
+	    coordSys(chart));
+}
+
+}
+
+const static auto tests =
+    "Draw::MarkerCache"_suite
+
+    | "steady frames reuse the markers" | []
+{
+	Vizzu::Chart chart;
+	setup(chart, Vizzu::Gen::ShapeType::rectangle);
+	showSteady(chart);
+
+	MarkerCache cache;
+	check->*updateMatches(cache, chart) == "first frame"_is_true;
+	check->*updateMatches(cache, chart) == "second frame"_is_true;
+	check->*updateMatches(cache, chart) == "third frame"_is_true;
+}
+
+    | "animation step morphing some markers" | []
+{
+	Vizzu::Chart chart;
+	setup(chart, Vizzu::Gen::ShapeType::rectangle);
+	showSteady(chart);
+
+	MarkerCache cache;
+	check->*updateMatches(cache, chart) == "steady"_is_true;
+
+	startFiltering(chart);
+	check->*updateMatches(cache, chart) == "started"_is_true;
+	for (auto progress : {0.5, 0.75, 1.0}) {
+		seek(chart, progress);
+		check->*updateMatches(cache, chart) == "step"_is_true;
+	}
+}
+
+    | "connecting markers follow their previous marker" | []
+{
+	for (auto geometry :
+	    {Vizzu::Gen::ShapeType::line, Vizzu::Gen::ShapeType::area}) {
+		Vizzu::Chart chart;
+		setup(chart, geometry);
+		showSteady(chart);
+
+		MarkerCache cache;
+		check->*updateMatches(cache, chart) == "steady"_is_true;
+
+		// only "B" changes, "C" is connected to it
+		startFiltering(chart);
+		check->*updateMatches(cache, chart) == "started"_is_true;
+		for (auto progress : {0.5, 0.75, 1.0}) {
+			seek(chart, progress);
+			check->*updateMatches(cache, chart) == "step"_is_true;
+		}
+	}
+}
+
+    | "coordinate system, style and orientation changes" | []
+{
+	Vizzu::Chart chart;
+	setup(chart, Vizzu::Gen::ShapeType::rectangle);
+	showSteady(chart);
+
+	const auto &plot = chart.getPlot();
+	const auto &options = *plot->getOptions();
+	const auto &style = plot->getStyle();
+
+	MarkerCache cache;
+	check->*updateMatches(cache, chart) == "steady"_is_true;
+
+	const CoordinateSystem shrunk{
+	    Geom::Rect{{10, 10}, {200, 100}}};
+	check->*updateMatches(cache, chart, options, style, shrunk)
+	    == "coordinate system changed"_is_true;
+	const CoordinateSystem polar{chart.getLayout().plotArea,
+	    0.0,
+	    ::Anim::Interpolated{Vizzu::Gen::CoordSystem::polar}};
+	check->*updateMatches(cache, chart, options, style, polar)
+	    == "polar"_is_true;
+
+	auto spaced = style;
+	spaced.plot.marker.rectangleSpacing =
+	    ::Anim::Interpolated<std::optional<double>>{0.9};
+	check->*updateMatches(cache,
+	    chart,
+	    options,
+	    spaced,
+	    coordSys(chart))
+	    == "style changed"_is_true;
+
+	auto rotated = options;
+	rotated.orientation = Vizzu::Gen::Options::OrientationType{
+	    !options.getOrientation()};
+	check->*updateMatches(cache,
+	    chart,
+	    rotated,
+	    style,
+	    coordSys(chart))
+	    == "orientation changed"_is_true;
+
+	check->*updateMatches(cache, chart) == "restored"_is_true;
+}
+
+    | "new plot with the same marker count" | []
+{
+	Vizzu::Chart chart;
+	setup(chart, Vizzu::Gen::ShapeType::rectangle);
+	showSteady(chart);
+
+	MarkerCache cache;
+	check->*updateMatches(cache, chart) == "first plot"_is_true;
+
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	auto &table = chart.getTable();
+	auto &channel = chart.getOptions().getChannels().at(y);
+	channel.removeSeries({"Meas1", std::ref(table)});
+	channel.addSeries({"Meas2", std::ref(table)});
+	showSteady(chart);
+	check->*chart.getPlot()->getMarkers().size() == 5U;
+	check->*updateMatches(cache, chart) == "second plot"_is_true;
+};
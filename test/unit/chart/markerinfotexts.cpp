@@ -0,0 +1,83 @@
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base/gfx/color.h"
+#include "base/gfx/draw/textbox.h"
+#include "chart/rendering/drawmarkerinfo.h"
+
+#include "../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+
+using TextCache = Vizzu::Draw::DrawMarkerInfo::TextCache;
+
+namespace
+{
+
+// the plot shares the tooltip content between the frames
+const auto info = std::make_shared<
+    const std::vector<std::pair<std::string, std::string>>>(
+    std::vector<std::pair<std::string, std::string>>{{"Dim5", "A"}});
+
+TextCache::Key key()
+{
+	TextCache::Key res;
+	res.info = info;
+	res.fontSize = 12.0;
+	res.color = Gfx::Color::Black();
+	return res;
+}
+
+std::shared_ptr<Gfx::Draw::TextBox> &fill(
+    std::shared_ptr<Gfx::Draw::TextBox> &text)
+{
+	if (!text) text = std::make_shared<Gfx::Draw::TextBox>();
+	return text;
+}
+
+}
+
+const static auto tests =
+    "Draw::DrawMarkerInfo::TextCache"_suite
+
+    | "tooltip text is reused" | []
+{
+	TextCache cache;
+	auto text = fill(cache.get(1, key()));
+
+	check->*(cache.get(1, key()) == text)
+	    == "same tooltip"_is_true;
+	check->*(cache.get(2, key()) == nullptr)
+	    == "other tooltip"_is_true;
+}
+
+    | "style change invalidates the tooltip text" | []
+{
+	TextCache cache;
+	auto text = fill(cache.get(1, key()));
+
+	auto resized = key();
+	resized.fontSize = 14.0;
+	check->*(cache.get(1, std::move(resized)) == nullptr)
+	    == "font size changed"_is_true;
+
+	auto recolored = key();
+	recolored.color = Gfx::Color::White();
+	check->*(cache.get(1, std::move(recolored)) == nullptr)
+	    == "color changed"_is_true;
+}
+
+    | "text measurement change invalidates the tooltip text" | []
+{
+	TextCache cache;
+	auto text = fill(cache.get(1, key()));
+
+	auto remeasured = key();
+	++remeasured.textGeneration;
+	check->*(cache.get(1, std::move(remeasured)) == nullptr)
+	    == "generation changed"_is_true;
+};
@@ -0,0 +1,278 @@
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <functional>
+#include <string>
+
+#include "base/anim/interpolated.h"
+#include "base/geom/rect.h"
+#include "base/gfx/recordingcanvas.h"
+#include "base/math/range.h"
+#include "base/util/eventdispatcher.h"
+#include "chart/generator/axis.h"
+#include "chart/generator/plot.h"
+#include "chart/main/events.h"
+#include "chart/rendering/drawaxes.h"
+#include "chart/rendering/drawingcontext.h"
+#include "chart/rendering/painter/coordinatesystem.h"
+#include "chart/rendering/painter/painter.h"
+#include "chart/rendering/rendercache.h"
+#include "chart/rendering/renderedchart.h"
+#include "chart/ui/chart.h"
+
+#include "../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+
+using Vizzu::Draw::DrawAxes;
+using Vizzu::Draw::RenderCache;
+using enum Vizzu::Gen::ChannelId;
+
+namespace
+{
+
+struct Canvas final : Gfx::RecordingCanvas, Vizzu::Draw::Painter
+{
+	void *getPainter() final { return static_cast<Painter *>(this); }
+	// cppcheck-suppress duplInheritedMember
+	ICanvas &getCanvas() final { return *this; }
+};
+
+// a tick which is never generated, marks the ticks of the cache
+const DrawAxes::Separator markSeparator{-1.0, 1.0};
+const DrawAxes::Interval markInterval{{-2.0, -1.0}, 1.0};
+
+void setup(Vizzu::Chart &chart, double maxY)
+{
+	auto &table = chart.getTable();
+	table.add_measure({{1, 2, 3, 4, 5, 6}}, "Meas1");
+	table.add_measure({{5, 4, 3, 2, 1, 8}}, "Meas2");
+
+	auto &channels = chart.getOptions().getChannels();
+	channels.at(x).addSeries({"Meas1", std::ref(table)});
+	channels.at(y).addSeries({"Meas2", std::ref(table)});
+	channels.at(y).range.max = Vizzu::Base::AutoParam{
+	    Vizzu::Gen::ChannelExtrema::fromString(
+	        std::to_string(maxY))};
+
+	chart.setBoundRect(Geom::Rect(Geom::Point{}, {{640, 480}}));
+	chart.getAnimOptions().control.position = 1.0;
+	chart.setKeyframe();
+	chart.animate({});
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	chart.setBoundRect(chart.getLayout().boundary);
+}
+
+// starts an animation to a new maximum of the y axis
+void animateRange(Vizzu::Chart &chart, double maxY)
+{
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+	chart.getOptions().getChannels().at(y).range.max =
+	    Vizzu::Base::AutoParam{Vizzu::Gen::ChannelExtrema::fromString(
+	        std::to_string(maxY))};
+	chart.getAnimOptions().control.position = 0.25;
+	chart.setKeyframe();
+	chart.animate({});
+	chart.getAnimControl()->update(std::chrono::steady_clock::now());
+}
+
+void seek(Vizzu::Chart &chart, double progress)
+{
+	chart.getAnimControl()->seekProgress(progress);
+	chart.getAnimControl()->update();
+}
+
+// generates the guides of the axes of the current plot
+void generate(const Vizzu::Chart &chart,
+    RenderCache *cache,
+    DrawAxes::Buffers &buffers)
+{
+	const auto &plot = chart.getPlot();
+	Util::EventDispatcher dispatcher;
+	const Vizzu::Events events{dispatcher};
+	const Vizzu::Draw::CoordinateSystem coordSys{
+	    chart.getLayout().plotArea,
+	    plot->getOptions()->angle,
+	    plot->getOptions()->coordSystem,
+	    plot->keepAspectRatio};
+	Vizzu::Draw::RenderedChart rendered{coordSys, plot};
+	const Vizzu::Draw::DrawingContext ctx{plot,
+	    plot->getOptions().get(),
+	    rendered,
+	    coordSys,
+	    plot->getStyle(),
+	    events,
+	    cache};
+	Canvas canvas;
+	static_cast<void>(
+	    DrawAxes{{ctx}, canvas, canvas, buffers, {}}.init());
+}
+
+void mark(RenderCache &cache)
+{
+	auto &ticks = cache.measureTicks[Vizzu::Gen::AxisId::y];
+	ticks.intervals.push_back(markInterval);
+	ticks.separators.push_back(markSeparator);
+}
+
+bool hasMarkedInterval(const DrawAxes::Buffers &buffers)
+{
+	return std::ranges::any_of(
+	    buffers.intervals[Vizzu::Gen::AxisId::y],
+	    [](const DrawAxes::Interval &interval)
+	    {
+		    return interval.range == markInterval.range;
+	    });
+}
+
+bool hasMarkedSeparator(const DrawAxes::Buffers &buffers)
+{
+	return std::ranges::any_of(
+	    buffers.separators[Vizzu::Gen::AxisId::y],
+	    [](const DrawAxes::Separator &separator)
+	    {
+		    return separator.position == markSeparator.position;
+	    });
+}
+
+// the guides of the cache match the ones generated without cache
+bool matchesFresh(const Vizzu::Chart &chart,
+    const DrawAxes::Buffers &buffers)
+{
+	DrawAxes::Buffers fresh;
+	generate(chart, nullptr, fresh);
+	for (auto axis : {Vizzu::Gen::AxisId::x, Vizzu::Gen::AxisId::y}) {
+		const auto &intervals = buffers.intervals[axis];
+		const auto &freshIntervals = fresh.intervals[axis];
+		if (intervals.size() != freshIntervals.size()) return false;
+		for (std::size_t i{}; i < intervals.size(); ++i)
+			if (intervals[i].range != freshIntervals[i].range
+			    || intervals[i].weight != freshIntervals[i].weight)
+				return false;
+
+		const auto &separators = buffers.separators[axis];
+		const auto &freshSeparators = fresh.separators[axis];
+		if (separators.size() != freshSeparators.size())
+			return false;
+		for (std::size_t i{}; i < separators.size(); ++i)
+			if (separators[i].position != freshSeparators[i].position
+			    || separators[i].weight != freshSeparators[i].weight
+			    || separators[i].label != freshSeparators[i].label)
+				return false;
+	}
+	return true;
+}
+
+// marks the cached ticks, applies the change to the plot and checks
+// that the ticks are generated again
+bool recomputed(const std::function<void(Vizzu::Gen::Axises &)>
+        &change)
+{
+	Vizzu::Chart chart;
+	setup(chart, 20.0);
+
+	RenderCache cache;
+	generate(chart, &cache, cache.axes);
+	mark(cache);
+
+	change(chart.getPlot()->axises);
+	generate(chart, &cache, cache.axes);
+	return !hasMarkedInterval(cache.axes)
+	    && !hasMarkedSeparator(cache.axes)
+	    && matchesFresh(chart, cache.axes);
+}
+
+}
+
+const static auto tests =
+    "Draw::DrawAxes::MeasureTicks"_suite
+
+    | "unchanged axis reuses the ticks" | []
+{
+	Vizzu::Chart chart;
+	setup(chart, 20.0);
+
+	RenderCache cache;
+	generate(chart, &cache, cache.axes);
+	check->*matchesFresh(chart, cache.axes) == "first frame"_is_true;
+	check->*cache.measureTicks[Vizzu::Gen::AxisId::y].key.has_value()
+	    == "key stored"_is_true;
+
+	mark(cache);
+	generate(chart, &cache, cache.axes);
+	check->*hasMarkedInterval(cache.axes)
+	    == "intervals reused"_is_true;
+	check->*hasMarkedSeparator(cache.axes)
+	    == "separators reused"_is_true;
+
+	generate(chart, &cache, cache.axes);
+	check->*hasMarkedSeparator(cache.axes)
+	    == "reused again"_is_true;
+}
+
+    | "changed enabled, step, range or origo recomputes the ticks" |
+    []
+{
+	using Vizzu::Gen::AxisId;
+
+	check->*recomputed(
+	    [](Vizzu::Gen::Axises &axises)
+	    {
+		    axises.at(AxisId::y).measure.enabled =
+		        ::Anim::interpolate(::Anim::Interpolated{true},
+		            ::Anim::Interpolated{false},
+		            0.25);
+	    })
+	    == "enabled changed"_is_true;
+
+	check->*recomputed(
+	    [](Vizzu::Gen::Axises &axises)
+	    {
+		    axises.at(AxisId::y).measure.step =
+		        ::Anim::Interpolated{0.5};
+	    })
+	    == "step changed"_is_true;
+
+	check->*recomputed(
+	    [](Vizzu::Gen::Axises &axises)
+	    {
+		    axises.at(AxisId::y).measure.range =
+		        Math::Range<>{0.0, 40.0};
+	    })
+	    == "range changed"_is_true;
+
+	check->*recomputed(
+	    [](Vizzu::Gen::Axises &axises)
+	    {
+		    axises.at(AxisId::x).measure.range =
+		        Math::Range<>{-3.0, 6.0};
+	    })
+	    == "origo changed"_is_true;
+}
+
+    | "animated range recomputes the ticks on each step" | []
+{
+	Vizzu::Chart chart;
+	setup(chart, 20.0);
+	animateRange(chart, 40.0);
+
+	RenderCache cache;
+	for (auto progress : {0.5, 0.75}) {
+		seek(chart, progress);
+		generate(chart, &cache, cache.axes);
+		check->*matchesFresh(chart, cache.axes) == "step"_is_true;
+
+		mark(cache);
+		generate(chart, &cache, cache.axes);
+		check->*hasMarkedSeparator(cache.axes)
+		    == "same step reused"_is_true;
+	}
+
+	seek(chart, 1.0);
+	generate(chart, &cache, cache.axes);
+	check->*!hasMarkedSeparator(cache.axes)
+	    == "next step recomputed"_is_true;
+	check->*matchesFresh(chart, cache.axes) == "last step"_is_true;
+};
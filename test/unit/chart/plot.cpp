@@ -0,0 +1,171 @@
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+#include "../util/test.h"
+#include "chart/generator/plot.h"
+#include "chart/generator/plotbuilder.h"
+#include "chart/main/style.h"
+
+using test::operator""_suite;
+using test::assert;
+using test::check;
+using test::throws;
+using test::operator""_is_true;
+
+using Vizzu::Gen::Marker;
+using Vizzu::Gen::Plot;
+using Vizzu::Gen::PlotPtr;
+
+namespace
+{
+
+PlotPtr prototype_plot()
+{
+	Vizzu::Data::DataTable table;
+	table.add_dimension({{"a"}}, {{0}}, "Dim");
+	table.add_measure({{1.0}}, "Meas");
+
+	auto options = std::make_shared<Vizzu::Gen::Options>();
+	options->getChannels()
+	    .at(Vizzu::Gen::ChannelId::x)
+	    .addSeries({"Dim", std::ref(table)});
+	options->setAutoParameters();
+
+	return Vizzu::Gen::PlotBuilder{table,
+	    options,
+	    Vizzu::Styles::Chart::def()}
+	    .build();
+}
+
+std::string marker_index(std::size_t ix)
+{
+	auto res = std::to_string(ix);
+	return std::string(8 - res.size(), '0') + res;
+}
+
+template <class Pred>
+PlotPtr plot_with(const PlotPtr &prototype,
+    std::size_t count,
+    Pred &&pred)
+{
+	auto res = std::make_shared<Plot>(*prototype);
+	res->detachMarkers();
+	auto &markers = res->mutableMarkers();
+	markers.clear();
+	markers.reserve(count);
+
+	std::string prev;
+	for (std::size_t ix{}; ix < count; ++ix) {
+		if (!pred(ix)) continue;
+		auto &marker =
+		    markers.emplace_back(prototype->getMarkers().front());
+		marker.idx = marker_index(ix);
+		marker.prevMainMarker =
+		    ::Anim::Interpolated{Marker::RelativeMarkerIndex{prev}};
+		prev = marker.idx;
+	}
+	return res;
+}
+
+}
+
+const static auto tests =
+    "Gen::Plot"_suite
+
+    | "merge markers of 100k markers changing by half" | []
+{
+	constexpr std::size_t count = 100000;
+
+	auto prototype = prototype_plot();
+	assert->*prototype->getMarkers().size() == 1u;
+
+	auto source = plot_with(prototype,
+	    count,
+	    [](std::size_t ix)
+	    {
+		    return ix % 4 < 2;
+	    });
+	auto target = plot_with(prototype,
+	    count,
+	    [](std::size_t ix)
+	    {
+		    return ix % 4 == 1 || ix % 4 == 2;
+	    });
+
+	Plot::mergeMarkersAndCellInfo(*source, *target);
+
+	const auto &smarkers = source->getMarkers();
+	const auto &tmarkers = target->getMarkers();
+	assert->*smarkers.size() == count / 4 * 3;
+	assert->*tmarkers.size() == count / 4 * 3;
+
+	std::size_t wrongIndex{};
+	std::size_t wrongEnabled{};
+	std::size_t wrongPrev{};
+	for (std::size_t ix{}; ix < smarkers.size(); ++ix) {
+		const auto &smarker = smarkers[ix];
+		const auto &tmarker = tmarkers[ix];
+		auto orig = std::stoul(smarker.idx);
+
+		wrongIndex += smarker.idx != tmarker.idx;
+		wrongEnabled += static_cast<bool>(smarker.enabled)
+		                 != (orig % 4 < 2);
+		wrongEnabled += static_cast<bool>(tmarker.enabled)
+		                 != (orig % 4 == 1 || orig % 4 == 2);
+
+		for (const auto *marker : {&smarker, &tmarker})
+			if (const auto &[idx, distance] =
+			        marker->prevMainMarker.get();
+			    !idx.empty()) {
+				auto prevIx =
+				    static_cast<std::ptrdiff_t>(ix) + distance;
+				wrongPrev +=
+				    prevIx < 0
+				    || smarkers[static_cast<std::size_t>(prevIx)].idx
+				           != idx;
+			}
+	}
+
+	check->*wrongIndex == 0u;
+	check->*wrongEnabled == 0u;
+	check->*wrongPrev == 0u;
+}
+
+    | "copies share markers until detached" | []
+{
+	auto prototype = prototype_plot();
+	auto source = plot_with(prototype,
+	    8,
+	    [](std::size_t ix)
+	    {
+		    return ix < 4;
+	    });
+	auto target = plot_with(prototype,
+	    8,
+	    [](std::size_t ix)
+	    {
+		    return ix >= 2;
+	    });
+
+	Plot sourceCopy{*source};
+	Plot targetCopy{*target};
+	check->*(&sourceCopy.getMarkers() == &source->getMarkers())
+	    == "markers shared"_is_true;
+	throws<std::logic_error>() << [&sourceCopy]
+	{
+		return sourceCopy.mutableMarkers().size();
+	};
+
+	Plot::mergeMarkersAndCellInfo(sourceCopy, targetCopy);
+
+	check->*sourceCopy.getMarkers().size() == 8u;
+	check->*source->getMarkers().size() == 4u;
+	check->*target->getMarkers().size() == 6u;
+
+	Plot actual{sourceCopy};
+	actual.detachMarkers();
+	actual.mutableMarkers().front().enabled = false;
+	check->*static_cast<bool>(sourceCopy.getMarkers().front().enabled)
+	    == "copied marker unchanged"_is_true;
+};
@@ -0,0 +1,127 @@
+#include "chart/rendering/renderedchart.h"
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+#include "../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+using test::operator""_is_false;
+
+using Vizzu::Draw::CoordinateSystem;
+using Vizzu::Draw::Marker;
+using Vizzu::Draw::RenderedChart;
+using Vizzu::Gen::ShapeType;
+
+namespace
+{
+
+struct Target final : Util::EventTarget
+{
+	std::size_t id;
+	explicit Target(std::size_t id) : id(id) {}
+	[[nodiscard]] std::string toJSON() const final
+	{
+		return std::to_string(id);
+	}
+};
+
+Marker marker(ShapeType shape, const Geom::Rect &rect)
+{
+	return {true,
+	    ::Anim::Interpolated{shape},
+	    {rect.bottomLeft(),
+	        rect.bottomRight(),
+	        rect.topRight(),
+	        rect.topLeft()},
+	    {0.0, 0.0}};
+}
+
+std::string hit(const RenderedChart &chart, const Geom::Point &point)
+{
+	const auto *target =
+	    chart.find(chart.getCoordSys().convert(point));
+	return target ? target->toJSON() : "none";
+}
+
+}
+
+const static auto tests =
+    "Draw::RenderedChart"_suite
+
+    | "find uses z-order with many markers" | []
+{
+	constexpr std::size_t count = 100;
+	const CoordinateSystem coordSys{
+	    Geom::Rect{{0.0, 0.0}, {1000.0, 1000.0}}};
+	RenderedChart chart{coordSys, {}};
+
+	chart.emplace(Geom::TransformedRect::fromRect(
+	                  Geom::Rect{{0.0, 0.0}, {1000.0, 1000.0}}),
+	    chart.getTargetPool().make<Target>(0));
+
+	constexpr double step = 1.0 / count;
+	for (std::size_t y{}; y < count; ++y)
+		for (std::size_t x{}; x < count; ++x)
+			chart.emplace(marker(ShapeType::rectangle,
+			                  {{static_cast<double>(x) * step,
+			                       static_cast<double>(y) * step},
+			                      {step / 2, step / 2}}),
+			    chart.getTargetPool().make<Target>(1 + y * count + x));
+
+	chart.emplace(marker(ShapeType::rectangle,
+	                  {{0.5, 0.5}, {0.25, 0.25}}),
+	    chart.getTargetPool().make<Target>(count * count + 1));
+
+	check->*hit(chart, {0.001, 0.001}) == "1";
+	check->*hit(chart, {0.4321, 0.2345}) == "2344";
+	check->*hit(chart, {0.6, 0.7}) == "10001";
+	check->*hit(chart, {0.0075, 0.0075}) == "0";
+	check->*hit(chart, {2.0, 2.0}) == "none";
+}
+
+    | "find hits line markers" | []
+{
+	const CoordinateSystem coordSys{
+	    Geom::Rect{{0.0, 0.0}, {1000.0, 500.0}}};
+	RenderedChart chart{coordSys, {}};
+
+	for (std::size_t ix{}; ix < 50; ++ix) {
+		auto x = static_cast<double>(ix) / 50.0;
+		chart.emplace(marker(ShapeType::line,
+		                  {{x, 0.2}, {0.02, 0.4}}),
+		    chart.getTargetPool().make<Target>(ix));
+	}
+
+	check->*hit(chart, {0.09, 0.6}) == "4";
+	check->*hit(chart, {0.11, 0.603}) == "5";
+	check->*hit(chart, {0.11, 0.2}) == "none";
+}
+
+    | "reused layers keep their elements" | []
+{
+	const CoordinateSystem coordSys{
+	    Geom::Rect{{0.0, 0.0}, {1.0, 1.0}}};
+	RenderedChart chart{coordSys, {}};
+
+	chart.beginLayer(0, 42);
+	chart.emplace(Geom::TransformedRect::fromRect({{0, 0}, {1, 1}}),
+	    chart.getTargetPool().make<Target>(7));
+	chart.endLayer();
+
+	chart.reset(coordSys, {});
+	check->*hit(chart, {0.5, 0.5}) == "none";
+	check->*chart.hasLayer(0, 43) == "stale key rejected"_is_false;
+	check->*chart.hasLayer(0, 42) == "layer kept"_is_true;
+
+	chart.reuseLayer(0, 42);
+	check->*hit(chart, {0.5, 0.5}) == "7";
+
+	chart.reset(coordSys, {});
+	check->*chart.hasLayer(0, 42) == "reused layer kept"_is_true;
+	chart.reset(coordSys, {});
+	check->*chart.hasLayer(0, 42) == "unused layer dropped"_is_false;
+};
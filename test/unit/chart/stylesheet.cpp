@@ -0,0 +1,60 @@
+#include "chart/main/stylesheet.h"
+
+#include <memory>
+
+#include "base/geom/point.h"
+#include "base/gfx/length.h"
+#include "base/style/paramcomparer.h"
+#include "chart/main/style.h"
+#include "chart/options/options.h"
+
+#include "../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+using test::operator""_is_false;
+
+using Vizzu::Styles::Chart;
+using Vizzu::Styles::Sheet;
+
+const static auto tests =
+    "Styles::Sheet"_suite
+
+    | "resolved styles are reused" | []
+{
+	Chart active;
+	Sheet sheet(Chart::def(), active);
+	auto options = std::make_shared<Vizzu::Gen::Options>();
+
+	auto first = sheet.getFullParams(options, {400, 300});
+	auto second = sheet.getFullParams(options, {400, 300});
+	check->*Style::ParamComparer::equals(first, second)
+	    == "same result"_is_true;
+
+	active.fontSize = Gfx::Length{20};
+	check->*sheet.getFullParams(options, {400, 300}).fontSize->get()
+	    == 20.0;
+
+	active.fontSize = Gfx::Length{30};
+	check->*sheet.getFullParams(options, {400, 300}).fontSize->get()
+	    == 30.0;
+}
+
+    | "cached defaults follow the size" | []
+{
+	Chart active;
+	Sheet sheet(Chart::def(), active);
+	auto options = std::make_shared<Vizzu::Gen::Options>();
+
+	auto small = sheet.getFullParams(options, {200, 100});
+	auto large = sheet.getFullParams(options, {2000, 1000});
+	check->*Style::ParamComparer::equals(small, large)
+	    == "size changes the font size"_is_false;
+
+	auto again = sheet.getFullParams(options, {200, 100});
+	check->*Style::ParamComparer::equals(small, again)
+	    == "same as the first"_is_true;
+	check->*sheet.getDefaultParams().fontSize->get()
+	    == small.fontSize->get();
+};
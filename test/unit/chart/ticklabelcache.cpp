@@ -0,0 +1,51 @@
+#include "chart/rendering/ticklabelcache.h"
+
+#include <string>
+
+#include "base/text/numberscale.h"
+#include "base/text/smartstring.h"
+
+#include "../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+using test::operator""_is_false;
+
+using Text::NumberFormat;
+using Text::NumberScale;
+using Vizzu::Draw::TickLabelCache;
+
+const static auto tests =
+    "Draw::TickLabelCache"_suite
+
+    | "labels are formatted once" | []
+{
+	TickLabelCache cache;
+	const NumberScale scale;
+
+	const auto &label =
+	    cache.get(1500.0, NumberFormat::prefixed, 1, scale, "$");
+	check->*label == "1.5 k$";
+	check->*(&cache.get(1500.0, NumberFormat::prefixed, 1, scale, "$")
+	         == &label)
+	    == "same string"_is_true;
+	check->*cache.get(1500.0, NumberFormat::prefixed, 1, scale, "")
+	    == "1.5 k";
+}
+
+    | "format change clears the labels" | []
+{
+	TickLabelCache cache;
+	const NumberScale scale;
+
+	check->*cache.get(1500.0, NumberFormat::grouped, 0, scale, "")
+	    == "1 500";
+	check->*cache.get(1500.0, NumberFormat::none, 0, scale, "")
+	    == "1500";
+	check->*cache.get(0.25, NumberFormat::none, 1, scale, "")
+	    == "0.3";
+	check->*(cache.get(0.25, NumberFormat::none, 2, scale, "")
+	         == "0.3")
+	    == "digits changed"_is_false;
+};
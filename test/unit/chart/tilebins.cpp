@@ -0,0 +1,104 @@
+#include "chart/rendering/tilebins.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <span>
+#include <utility>
+#include <vector>
+
+#include "base/geom/rect.h"
+#include "base/gfx/canvas.h"
+
+#include "../util/test.h"
+
+using test::operator""_suite;
+using test::check;
+using test::operator""_is_true;
+
+using Vizzu::Draw::TileBins;
+
+namespace
+{
+
+// 3 x 2 tiles of 10 x 10 from (5, 5)
+TileBins grid()
+{
+	return TileBins{Gfx::ICanvas::TileGrid{{5, 5}, {10, 10}, 3, 2}};
+}
+
+std::vector<std::uint32_t> bin(const TileBins &bins,
+    std::size_t tile)
+{
+	auto res = bins[tile];
+	return {res.begin(), res.end()};
+}
+
+}
+
+const static auto tests =
+    "Draw::TileBins"_suite
+
+    | "cells cover the range clamped to the grid" | []
+{
+	using Cells = std::pair<std::size_t, std::size_t>;
+	check->*(TileBins::cells(2, 8, 10, 4) == Cells{0, 1})
+	    == "inside one cell"_is_true;
+	check->*(TileBins::cells(8, 12, 10, 4) == Cells{0, 2})
+	    == "crossing a border"_is_true;
+	check->*(TileBins::cells(-15, 3, 10, 4) == Cells{0, 1})
+	    == "clamped at the start"_is_true;
+	check->*(TileBins::cells(35, 90, 10, 4) == Cells{3, 4})
+	    == "clamped at the end"_is_true;
+	check->*(TileBins::cells(20, 20, 10, 4) == Cells{2, 3})
+	    == "on a border"_is_true;
+}
+
+    | "shapes are binned to the tiles they overlap" | []
+{
+	auto bins = grid();
+	bins.add(0, Geom::Rect{{7, 7}, {2, 2}}, 0.0);
+	bins.add(1, Geom::Rect{{12, 12}, {6, 6}}, 0.0);
+	bins.add(2, Geom::Rect{{28, 20}, {1, 1}}, 0.0);
+
+	check->*(bin(bins, 0) == std::vector<std::uint32_t>{0, 1})
+	    == "bottom left"_is_true;
+	check->*(bin(bins, 1) == std::vector<std::uint32_t>{1})
+	    == "bottom middle"_is_true;
+	check->*(bin(bins, 3) == std::vector<std::uint32_t>{1})
+	    == "top left"_is_true;
+	check->*(bin(bins, 4) == std::vector<std::uint32_t>{1})
+	    == "top middle"_is_true;
+	check->*(bin(bins, 5) == std::vector<std::uint32_t>{2})
+	    == "top right"_is_true;
+	check->*bins[2].empty() == "bottom right"_is_true;
+}
+
+    | "margin extends the shapes into the neighbour tiles" | []
+{
+	auto bins = grid();
+	bins.add(0, Geom::Rect{{10, 12}, {4, 2}}, 0.0);
+	bins.add(1, Geom::Rect{{10, 12}, {4, 2}}, 1.5);
+
+	check->*(bin(bins, 0) == std::vector<std::uint32_t>{0, 1})
+	    == "own tile"_is_true;
+	check->*(bin(bins, 1) == std::vector<std::uint32_t>{1})
+	    == "right neighbour"_is_true;
+	check->*(bin(bins, 3) == std::vector<std::uint32_t>{1})
+	    == "top neighbour"_is_true;
+	check->*(bin(bins, 4) == std::vector<std::uint32_t>{1})
+	    == "diagonal neighbour"_is_true;
+	check->*bins[2].empty() == "far tile"_is_true;
+}
+
+    | "shapes outside the grid are skipped" | []
+{
+	auto bins = grid();
+	bins.add(0, Geom::Rect{{-10, 0}, {4, 4}}, 1.0);
+	bins.add(1, Geom::Rect{{40, 30}, {4, 4}}, 1.0);
+	bins.add(2, Geom::Rect{{0, 0}, {5.5, 5.5}}, 0.0);
+
+	check->*(bin(bins, 0) == std::vector<std::uint32_t>{2})
+	    == "only the overlapping one"_is_true;
+	for (auto tile = 1U; tile < 6; ++tile)
+		check->*bins[tile].empty() == "others empty"_is_true;
+};
@@ -1,3 +1,4 @@
+#include <array>
 
 #include "dataframe/impl/dataframe.h"
 #include "dataframe/interface.h"
@@ -847,4 +848,33 @@ auto &&m1t = df->set_aggregate("m1",
 	    == "is nan"_is_true;
 }
 
+    | "snapshot shares the data until modified" | []
+{
+	Vizzu::dataframe::dataframe table;
+	const std::array<const char *, 2> categories{"a", "b"};
+	const std::array<std::uint32_t, 2> values{0, 1};
+	table.add_dimension(categories, values, "d1");
+	table.add_measure(std::array{1.0, 2.0}, "m1");
+
+	auto snapshot = table.snapshot();
+	check->*(snapshot.get_categories("d1").data()
+	         == table.get_categories("d1").data())
+	    == "categories shared"_is_true;
+
+	table.change_data(std::size_t{0}, "m1", 5.0);
+	table.add_measure(std::array{3.0, 4.0}, "m2");
+
+	check->*table.get_data(std::size_t{0}, "m1") == 5.0;
+	check->*snapshot.get_data(std::size_t{0}, "m1") == 1.0;
+	check->*table.get_measures().size() == std::size_t{2};
+	check->*snapshot.get_measures().size() == std::size_t{1};
+
+	auto other = table.snapshot();
+	other.change_data(std::size_t{1}, "d1", "c");
+
+	check->*other.get_data(std::size_t{1}, "d1") == "c";
+	check->*table.get_data(std::size_t{1}, "d1") == "b";
+	check->*snapshot.get_data(std::size_t{1}, "d1") == "b";
+}
+
 ;